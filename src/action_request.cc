@@ -35,6 +35,7 @@
 #include "action_request.h" // API
 
 #include "exceptions.h"
+#include "upnp/didl_writer.h"
 #include "upnp/quirks.h"
 #include "upnp/upnp_common.h"
 #include "upnp/xml_builder.h"
@@ -92,6 +93,13 @@ std::unique_ptr<pugi::xml_document> ActionRequest::getRequest() const
 void ActionRequest::setResponse(std::unique_ptr<pugi::xml_document> response)
 {
     this->response = std::move(response);
+    this->result.clear();
+}
+
+void ActionRequest::setResponse(std::unique_ptr<pugi::xml_document> response, std::string result)
+{
+    this->response = std::move(response);
+    this->result = std::move(result);
 }
 
 void ActionRequest::setErrorCode(int errCode)
@@ -102,24 +110,24 @@ void ActionRequest::setErrorCode(int errCode)
 void ActionRequest::update()
 {
     if (response) {
-        std::string xml = UpnpXMLBuilder::printXml(*response, "", 0);
+        std::string xml = result.empty() ? UpnpXMLBuilder::printXml(*response, "", 0) : DidlWriter::printResponse(*response, result);
         log_debug("xml: {}", xml);
 
 #if defined(USING_NPUPNP)
         UpnpActionRequest_set_xmlResponse(upnp_request, xml);
         UpnpActionRequest_set_ErrCode(upnp_request, errCode);
 #else
-        IXML_Document* result = nullptr;
-        int err = ixmlParseBufferEx(xml.c_str(), &result);
+        IXML_Document* ixmlResult = nullptr;
+        int err = ixmlParseBufferEx(xml.c_str(), &ixmlResult);
 
         if (err != IXML_SUCCESS) {
             log_error("ActionRequest::update(): could not convert to iXML, code {}", err);
             UpnpActionRequest_set_ErrCode(upnp_request, UPNP_E_ACTION_FAILED);
-            if (result)
-                ixmlDocument_free(result);
+            if (ixmlResult)
+                ixmlDocument_free(ixmlResult);
         } else {
             log_debug("ActionRequest::update(): converted to iXML, code {}", errCode);
-            UpnpActionRequest_set_ActionResult(upnp_request, result);
+            UpnpActionRequest_set_ActionResult(upnp_request, ixmlResult);
             UpnpActionRequest_set_ErrCode(upnp_request, errCode);
         }
 #endif
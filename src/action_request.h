@@ -85,6 +85,11 @@ protected:
     /// Set by setResponse()
     std::unique_ptr<pugi::xml_document> response;
 
+    /// @brief Escaped content of the Result element of the response.
+    ///
+    /// Set by setResponse()
+    std::string result;
+
 public:
     /// @brief The Constructor takes the values from the upnp_request and fills in internal variables.
     /// @param xmlBuilder builder for xml
@@ -112,6 +117,11 @@ public:
     /// @param response XML holding the action response.
     void setResponse(std::unique_ptr<pugi::xml_document> response);
 
+    /// @brief Sets the response with a Result rendered by DidlWriter
+    /// @param response XML holding the action response with an empty Result element.
+    /// @param result escaped content of the Result element.
+    void setResponse(std::unique_ptr<pugi::xml_document> response, std::string result);
+
     /// @brief Set the error code for the SDK.
     /// @param errCode UPnP error code.
     ///
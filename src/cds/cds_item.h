@@ -37,8 +37,8 @@ class ClientStatusDetail;
 /// @brief An Item in the content directory.
 class CdsItem : public CdsObject {
 protected:
-    /// @brief mime-type of the media.
-    std::string mimeType { MIMETYPE_DEFAULT };
+    /// @brief mime-type of the media, shared by all items of the type
+    InternedString mimeType { MIMETYPE_DEFAULT };
 
     /// @brief number of part, e.g. disk or season
     int partNumber {};
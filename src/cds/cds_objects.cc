@@ -112,7 +112,7 @@ void CdsObject::validate() const
 
 bool CdsObject::isSubClass(const std::string& cls) const
 {
-    return startswith(upnpClass, cls);
+    return startswith(upnpClass.str(), cls);
 }
 
 std::string CdsObject::getAuxData(const std::string& key) const
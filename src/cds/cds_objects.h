@@ -39,6 +39,7 @@
 #include "metadata/metadata_enums.h"
 #include "util/enum_iterator.h"
 #include "util/grb_fs.h"
+#include "util/string_pool.h"
 
 #include <algorithm>
 #include <map>
@@ -98,8 +99,8 @@ protected:
     /// @brief dc:title
     std::string title;
 
-    /// @brief upnp:class
-    std::string upnpClass;
+    /// @brief upnp:class, shared by all objects of the class
+    InternedString upnpClass;
 
     /// @brief Physical location of the media.
     fs::path location;
@@ -287,6 +287,24 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getServerOptions()
         std::make_shared<ConfigUIntSetup>(ConfigVal::SERVER_STORAGE_STRING_LIMIT,
             "/server/storage/attribute::string-limit", "config-server.html#confval-string-limit",
             255),
+        std::make_shared<ConfigUIntSetup>(ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_SIZE,
+            "/server/storage/attribute::child-count-cache-size", "config-server.html#confval-child-count-cache-size",
+            10000),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_CHECK,
+            "/server/storage/attribute::child-count-cache-check", "config-server.html#confval-child-count-cache-check",
+            NO),
+        std::make_shared<ConfigUIntSetup>(ConfigVal::SERVER_STORAGE_BROWSE_CURSOR_CACHE_SIZE,
+            "/server/storage/attribute::browse-cursor-cache-size", "config-server.html#confval-browse-cursor-cache-size",
+            0),
+        std::make_shared<ConfigUIntSetup>(ConfigVal::SERVER_STORAGE_VIRTUAL_PATH_CACHE_SIZE,
+            "/server/storage/attribute::virtual-path-cache-size", "config-server.html#confval-virtual-path-cache-size",
+            100000),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::SERVER_STORAGE_FULLTEXT_SEARCH,
+            "/server/storage/attribute::fulltext-search", "config-server.html#confval-fulltext-search",
+            NO),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::SERVER_STORAGE_CONTAINER_CLOSURE,
+            "/server/storage/attribute::container-closure", "config-server.html#confval-container-closure",
+            NO),
 
         std::make_shared<ConfigStringSetup>(ConfigVal::SERVER_STORAGE_DRIVER,
             "/server/storage/driver", "config-server.html#storage"),
@@ -298,6 +316,9 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getServerOptions()
         std::make_shared<ConfigIntSetup>(ConfigVal::SERVER_STORAGE_SQLITE_SHUTDOWN_ATTEMPTS,
             "/server/storage/sqlite3/attribute::shutdown-attempts", "config-server.html#confval-shutdown-attempts",
             5, 2, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigIntSetup>(ConfigVal::SERVER_STORAGE_SQLITE_READ_POOL_SIZE,
+            "/server/storage/sqlite3/attribute::read-pool-size", "config-server.html#confval-read-pool-size",
+            0, 0, ConfigIntSetup::CheckMinValue),
         std::make_shared<ConfigPathSetup>(ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE,
             "/server/storage/sqlite3/database-file", "config-server.html#confval-database-file",
             "gerbera.db", ConfigPathArguments::isFile | ConfigPathArguments::resolveEmpty),
@@ -496,6 +517,9 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getServerOptions()
             "/server/attribute::upnp-max-jobs", "config-server.html#confval-upnp-max-jobs",
             500),
 #endif
+        std::make_shared<ConfigBoolSetup>(ConfigVal::SERVER_READ_AHEAD_FILE_IO,
+            "/server/attribute::read-ahead-file-io", "config-server.html#confval-read-ahead-file-io",
+            NO),
 
         // UPNP control
         std::make_shared<ConfigBoolSetup>(ConfigVal::UPNP_LITERAL_HOST_REDIRECTION,
@@ -519,6 +543,9 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getServerOptions()
         std::make_shared<ConfigIntSetup>(ConfigVal::UPNP_CAPTION_COUNT,
             "/server/upnp/attribute::caption-info-count", "config-server.html#confval-caption-info-count",
             -1, -1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigUIntSetup>(ConfigVal::UPNP_BROWSE_CACHE_SIZE,
+            "/server/upnp/attribute::browse-cache-size", "config-server.html#confval-browse-cache-size",
+            0),
         std::make_shared<ConfigArraySetup>(ConfigVal::UPNP_SEARCH_ITEM_SEGMENTS,
             "/server/upnp/search-item-result", "config-server.html#confval-search-item-result",
             ConfigVal::A_IMPORT_LIBOPTS_AUXDATA_DATA, ConfigVal::A_IMPORT_LIBOPTS_AUXDATA_TAG,
@@ -662,6 +689,12 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getServerExtendedOpt
         std::make_shared<ConfigStringSetup>(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR, // ConfigPathSetup
             "/server/extended-runtime-options/ffmpegthumbnailer/cache-dir", "config-extended.html#confval-ffmpegthumbnailer-cache-dir",
             ""),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_PREGENERATE,
+            "/server/extended-runtime-options/ffmpegthumbnailer/cache-dir/attribute::pregenerate", "config-extended.html#confval-ffmpegthumbnailer-cache-dir-pregenerate",
+            NO),
+        std::make_shared<ConfigIntSetup>(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_WORKER_COUNT,
+            "/server/extended-runtime-options/ffmpegthumbnailer/attribute::worker-count", "config-extended.html#confval-ffmpegthumbnailer-worker-count",
+            1, 1, ConfigIntSetup::CheckMinValue),
 #endif
 
         // Playmarks
@@ -1114,6 +1147,24 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getImportOptions()
         std::make_shared<ConfigStringSetup>(ConfigVal::IMPORT_NOMEDIA_FILE,
             "/import/attribute::nomedia-file", "config-import.html#confval-nomedia-file",
             ".nomedia"),
+        std::make_shared<ConfigIntSetup>(ConfigVal::IMPORT_METADATA_THREADS,
+            "/import/attribute::metadata-threads", "config-import.html#confval-metadata-threads",
+            1, 1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigIntSetup>(ConfigVal::IMPORT_SCAN_THREADS,
+            "/import/attribute::scan-threads", "config-import.html#confval-scan-threads",
+            1, 1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigIntSetup>(ConfigVal::IMPORT_BATCH_SIZE,
+            "/import/attribute::batch-size", "config-import.html#confval-batch-size",
+            100, 1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigIntSetup>(ConfigVal::IMPORT_TASK_THREADS,
+            "/import/attribute::task-threads", "config-import.html#confval-task-threads",
+            1, 1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::IMPORT_PATH_INDEX,
+            "/import/attribute::path-index", "config-import.html#confval-path-index",
+            YES),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::IMPORT_PRUNE_UNCHANGED_DIRS,
+            "/import/attribute::prune-unchanged-dirs", "config-import.html#confval-prune-unchanged-dirs",
+            NO),
         std::make_shared<ConfigEnumSetup<ImportMode>>(ConfigVal::IMPORT_LAYOUT_MODE,
             "/import/attribute::import-mode", "config-import.html#confval-import-mode",
             ImportMode::MediaTomb,
@@ -1193,6 +1244,12 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getImportOptions()
         std::make_shared<ConfigTimeSetup>(ConfigVal::IMPORT_SCRIPTING_SCAN_INTERVAL,
             "/import/scripting/attribute::scan-interval", "config-import.html#confval-scripting-scan-interval",
             GrbTimeType::Minutes, 48 * 60, 0),
+        std::make_shared<ConfigIntSetup>(ConfigVal::IMPORT_SCRIPTING_HEAP_COUNT,
+            "/import/scripting/attribute::script-heaps", "config-import.html#confval-script-heaps",
+            1, 1, ConfigIntSetup::CheckMinValue),
+        std::make_shared<ConfigBoolSetup>(ConfigVal::IMPORT_SCRIPTING_BYTECODE_CACHE,
+            "/import/scripting/attribute::bytecode-cache", "config-import.html#confval-bytecode-cache",
+            NO),
         std::make_shared<ConfigStringSetup>(ConfigVal::IMPORT_SCRIPTING_CHARSET,
             "/import/scripting/attribute::script-charset", "config-import.html#confval-script-charset",
             "UTF-8", ConfigStringSetup::CheckCharset),
@@ -1224,6 +1281,9 @@ std::vector<std::shared_ptr<ConfigSetup>> ConfigDefinition::getImportOptions()
         std::make_shared<ConfigStringSetup>(ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_IMAGEFILE,
             "/import/scripting/import-function/image-file", "config-import.html#confval-image-file",
             "importImage"),
+        std::make_shared<ConfigStringSetup>(ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_ITEMS,
+            "/import/scripting/import-function/items", "config-import.html#confval-items",
+            ""),
 #ifdef ONLINE_SERVICES
         std::make_shared<ConfigStringSetup>(ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_TRAILER,
             "/import/scripting/import-function/online-item", "config-import.html#confval-trailer",
@@ -2484,6 +2544,7 @@ void ConfigDefinition::initDependencies()
         { ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
         { ConfigVal::SERVER_STORAGE_SQLITE_SYNCHRONOUS, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
         { ConfigVal::SERVER_STORAGE_SQLITE_JOURNALMODE, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
+        { ConfigVal::SERVER_STORAGE_SQLITE_READ_POOL_SIZE, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
         { ConfigVal::SERVER_STORAGE_SQLITE_RESTORE, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
         { ConfigVal::SERVER_STORAGE_SQLITE_BACKUP_ENABLED, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
         { ConfigVal::SERVER_STORAGE_SQLITE_BACKUP_INTERVAL, ConfigVal::SERVER_STORAGE_SQLITE_ENABLED },
@@ -386,9 +386,11 @@ void ConfigGenerator::generateServerOptions(
         { ConfigVal::UPNP_OBJECT_PROPERTY_DEFAULTS, ConfigLevel::Example },
         { ConfigVal::UPNP_CONTAINER_PROPERTY_DEFAULTS, ConfigLevel::Example },
         { ConfigVal::UPNP_CAPTION_COUNT, ConfigLevel::Example },
+        { ConfigVal::UPNP_BROWSE_CACHE_SIZE, ConfigLevel::Advanced },
 #ifdef GRBDEBUG
         { ConfigVal::SERVER_LOG_DEBUG_MODE, ConfigLevel::Example },
 #endif
+        { ConfigVal::SERVER_READ_AHEAD_FILE_IO, ConfigLevel::Advanced },
     };
 
     generateUdn(false);
@@ -504,6 +506,12 @@ void ConfigGenerator::generateDatabase(const fs::path& prefixDir)
         { ConfigVal::SERVER_STORAGE_USE_TRANSACTIONS, ConfigLevel::Example },
         { ConfigVal::SERVER_STORAGE_SORT_KEY_ENABLED, ConfigLevel::Example },
         { ConfigVal::SERVER_STORAGE_STRING_LIMIT, ConfigLevel::Example },
+        { ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_SIZE, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_CHECK, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_STORAGE_BROWSE_CURSOR_CACHE_SIZE, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_STORAGE_VIRTUAL_PATH_CACHE_SIZE, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_STORAGE_FULLTEXT_SEARCH, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_STORAGE_CONTAINER_CLOSURE, ConfigLevel::Advanced },
         { ConfigVal::SERVER_STORAGE_SQLITE_SYNCHRONOUS, ConfigLevel::Example },
         { ConfigVal::SERVER_STORAGE_SQLITE_JOURNALMODE, ConfigLevel::Example },
         { ConfigVal::SERVER_STORAGE_SQLITE_RESTORE, ConfigLevel::Example },
@@ -590,6 +598,8 @@ void ConfigGenerator::generateExtendedRuntime()
         { ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_IMAGE_ENABLED, ConfigLevel::Example },
         { ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_ENABLED, ConfigLevel::Example },
         { ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR, ConfigLevel::Example },
+        { ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_PREGENERATE, ConfigLevel::Advanced },
+        { ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_WORKER_COUNT, ConfigLevel::Advanced },
 #endif
         { ConfigVal::SERVER_EXTOPTS_MARK_PLAYED_ITEMS_ENABLED, ConfigLevel::Base },
         { ConfigVal::SERVER_EXTOPTS_MARK_PLAYED_ITEMS_SUPPRESS_CDS_UPDATES, ConfigLevel::Base },
@@ -630,6 +640,12 @@ void ConfigGenerator::generateImportOptions(
         { ConfigVal::IMPORT_DEFAULT_DATE, ConfigLevel::Example },
         { ConfigVal::IMPORT_LAYOUT_MODE, ConfigLevel::Example },
         { ConfigVal::IMPORT_NOMEDIA_FILE, ConfigLevel::Example },
+        { ConfigVal::IMPORT_METADATA_THREADS, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_SCAN_THREADS, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_BATCH_SIZE, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_TASK_THREADS, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_PATH_INDEX, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_PRUNE_UNCHANGED_DIRS, ConfigLevel::Advanced },
         { ConfigVal::IMPORT_VIRTUAL_DIRECTORY_KEYS, ConfigLevel::Example },
         { ConfigVal::IMPORT_FILESYSTEM_CHARSET, ConfigLevel::Example },
         { ConfigVal::IMPORT_METADATA_CHARSET, ConfigLevel::Example },
@@ -637,6 +653,8 @@ void ConfigGenerator::generateImportOptions(
 #ifdef HAVE_JS
         { ConfigVal::IMPORT_SCRIPTING_CHARSET, ConfigLevel::Base },
         { ConfigVal::IMPORT_SCRIPTING_SCAN_MODE, ConfigLevel::Example },
+        { ConfigVal::IMPORT_SCRIPTING_HEAP_COUNT, ConfigLevel::Advanced },
+        { ConfigVal::IMPORT_SCRIPTING_BYTECODE_CACHE, ConfigLevel::Advanced },
         { ConfigVal::IMPORT_SCRIPTING_COMMON_FOLDER, ConfigLevel::Base },
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_PLAYLIST, ConfigLevel::Base },
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_METAFILE, ConfigLevel::Base },
@@ -644,6 +662,7 @@ void ConfigGenerator::generateImportOptions(
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_AUDIOFILE, ConfigLevel::Base },
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_VIDEOFILE, ConfigLevel::Base },
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_IMAGEFILE, ConfigLevel::Base },
+        { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_ITEMS, ConfigLevel::Advanced },
 #ifdef ONLINESERVICES
         { ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_TRAILER, ConfigLevel::Base },
 #endif
@@ -80,6 +80,12 @@ enum class ConfigVal {
     SERVER_STORAGE_USE_TRANSACTIONS,
     SERVER_STORAGE_SORT_KEY_ENABLED,
     SERVER_STORAGE_STRING_LIMIT,
+    SERVER_STORAGE_CHILD_COUNT_CACHE_SIZE,
+    SERVER_STORAGE_CHILD_COUNT_CACHE_CHECK,
+    SERVER_STORAGE_BROWSE_CURSOR_CACHE_SIZE,
+    SERVER_STORAGE_VIRTUAL_PATH_CACHE_SIZE,
+    SERVER_STORAGE_FULLTEXT_SEARCH,
+    SERVER_STORAGE_CONTAINER_CLOSURE,
     SERVER_STORAGE_SQLITE_ENABLED,
     SERVER_STORAGE_SQLITE_DATABASE_FILE,
     SERVER_STORAGE_SQLITE_SYNCHRONOUS,
@@ -91,6 +97,7 @@ enum class ConfigVal {
     SERVER_STORAGE_SQLITE_UPGRADE_FILE,
     SERVER_STORAGE_SQLITE_DROP_FILE,
     SERVER_STORAGE_SQLITE_SHUTDOWN_ATTEMPTS,
+    SERVER_STORAGE_SQLITE_READ_POOL_SIZE,
     SERVER_STORAGE_MYSQL_ENABLED,
 #ifdef HAVE_MYSQL
     SERVER_STORAGE_MYSQL_HOST,
@@ -129,6 +136,8 @@ enum class ConfigVal {
     SERVER_EXTOPTS_FFMPEGTHUMBNAILER_IMAGE_QUALITY,
     SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_ENABLED,
     SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR,
+    SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_PREGENERATE,
+    SERVER_EXTOPTS_FFMPEGTHUMBNAILER_WORKER_COUNT,
 #endif
     SERVER_EXTOPTS_MARK_PLAYED_ITEMS_ENABLED,
     SERVER_EXTOPTS_MARK_PLAYED_ITEMS_STRING_MODE_PREPEND,
@@ -148,11 +157,18 @@ enum class ConfigVal {
 #ifdef UPNP_HAVE_TOOLS
     SERVER_UPNP_MAXJOBS,
 #endif
+    SERVER_READ_AHEAD_FILE_IO,
     IMPORT_HIDDEN_FILES,
     IMPORT_FOLLOW_SYMLINKS,
     IMPORT_DEFAULT_DATE,
     IMPORT_LAYOUT_MODE,
     IMPORT_NOMEDIA_FILE,
+    IMPORT_METADATA_THREADS,
+    IMPORT_SCAN_THREADS,
+    IMPORT_BATCH_SIZE,
+    IMPORT_TASK_THREADS,
+    IMPORT_PATH_INDEX,
+    IMPORT_PRUNE_UNCHANGED_DIRS,
     IMPORT_VIRTUAL_DIRECTORY_KEYS,
     IMPORT_FILESYSTEM_CHARSET,
     IMPORT_METADATA_CHARSET,
@@ -161,6 +177,8 @@ enum class ConfigVal {
     IMPORT_SCRIPTING_CHARSET,
     IMPORT_SCRIPTING_SCAN_MODE,
     IMPORT_SCRIPTING_SCAN_INTERVAL,
+    IMPORT_SCRIPTING_HEAP_COUNT,
+    IMPORT_SCRIPTING_BYTECODE_CACHE,
     IMPORT_SCRIPTING_IMPORT_SCRIPT_OPTIONS,
 
     IMPORT_SCRIPTING_COMMON_FOLDER,
@@ -172,6 +190,7 @@ enum class ConfigVal {
     IMPORT_SCRIPTING_IMPORT_FUNCTION_AUDIOFILE,
     IMPORT_SCRIPTING_IMPORT_FUNCTION_VIDEOFILE,
     IMPORT_SCRIPTING_IMPORT_FUNCTION_IMAGEFILE,
+    IMPORT_SCRIPTING_IMPORT_FUNCTION_ITEMS,
 #ifdef ONLINE_SERVICES
     IMPORT_SCRIPTING_IMPORT_FUNCTION_TRAILER,
 #endif
@@ -327,6 +346,7 @@ enum class ConfigVal {
     UPNP_OBJECT_PROPERTY_DEFAULTS,
     UPNP_CONTAINER_PROPERTY_DEFAULTS,
     UPNP_CAPTION_COUNT,
+    UPNP_BROWSE_CACHE_SIZE,
     IMPORT_READABLE_NAMES,
     IMPORT_CASE_SENSITIVE_TAGS,
     SERVER_DYNAMIC_CONTENT_LIST_ENABLED,
@@ -220,6 +220,13 @@ std::chrono::seconds AutoscanDirectory::getPreviousLMT(const fs::path& loc, cons
     return last_mod_previous_scan;
 }
 
+bool AutoscanDirectory::isUnchangedDir(const fs::path& loc, fs::file_time_type mtime) const
+{
+    // any change, also to the past or within the same second, means that the directory has to be read
+    auto dirEntry = dirModified.find(loc);
+    return dirEntry != dirModified.end() && dirEntry->second == mtime;
+}
+
 std::chrono::seconds AutoscanDirectory::getPreviousLMT() const
 {
     return last_mod_previous_scan;
@@ -199,10 +199,15 @@ public:
     void setCurrentLMT(const fs::path& loc, std::chrono::seconds lmt);
     std::chrono::seconds getPreviousLMT() const;
     std::chrono::seconds getPreviousLMT(const fs::path& loc, const std::shared_ptr<CdsContainer>& parent) const;
+    /// @brief Record the modification time of a directory itself after its contents were imported
+    void setDirModified(const fs::path& loc, fs::file_time_type mtime) { dirModified[loc] = mtime; }
+    /// @brief Check whether a directory was not modified since its contents were imported
+    bool isUnchangedDir(const fs::path& loc, fs::file_time_type mtime) const;
     bool updateLMT();
     void resetLMT()
     {
         lastModified.clear();
+        dirModified.clear();
         last_mod_previous_scan = {};
         last_mod_current_scan = {};
     }
@@ -264,6 +269,8 @@ protected:
     std::chrono::seconds last_mod_current_scan = std::chrono::seconds::zero();
     std::shared_ptr<Timer::Parameter> timer_parameter { std::make_shared<Timer::Parameter>(Timer::TimerParamType::IDAutoscan, INVALID_SCAN_ID) };
     std::map<fs::path, std::chrono::seconds> lastModified;
+    /// @brief modification times of the directories, not of their contents
+    std::map<fs::path, fs::file_time_type> dirModified;
     unsigned int activeScanCount {};
     std::map<std::string, bool> scanContent { { UPNP_CLASS_AUDIO_ITEM, true }, { UPNP_CLASS_IMAGE_ITEM, true }, { UPNP_CLASS_VIDEO_ITEM, true } };
     int mediaType { -1 };
@@ -53,6 +53,14 @@ fs::path CMAddFileTask::getPath() const { return dirEnt.path(); }
 
 fs::path CMAddFileTask::getRootPath() const { return rootpath; }
 
+/// @brief tasks of autoscan directories with their own import service can run in parallel
+static fs::path getAutoscanScope(const std::shared_ptr<AutoscanDirectory>& adir)
+{
+    return adir && adir->getImportService() ? adir->getLocation() : fs::path();
+}
+
+fs::path CMAddFileTask::getScope() const { return getAutoscanScope(asSetting.adir); }
+
 void CMAddFileTask::run()
 {
     log_debug("running add file task with path {} recursive: {}", dirEnt.path().c_str(), asSetting.recursive);
@@ -81,6 +89,8 @@ CMRemoveObjectTask::CMRemoveObjectTask(std::shared_ptr<ContentManager> content,
     this->cancellable = false;
 }
 
+fs::path CMRemoveObjectTask::getScope() const { return getAutoscanScope(adir); }
+
 void CMRemoveObjectTask::run()
 {
     content->_removeObject(adir, object, path, rescanResource, all);
@@ -97,6 +107,8 @@ CMRescanDirectoryTask::CMRescanDirectoryTask(std::shared_ptr<ContentManager> con
     this->taskType = TaskType::RescanDirectory;
 }
 
+fs::path CMRescanDirectoryTask::getScope() const { return getAutoscanScope(adir); }
+
 void CMRescanDirectoryTask::run()
 {
     if (!adir)
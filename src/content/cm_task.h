@@ -57,6 +57,7 @@ public:
         bool cancellable = true);
     fs::path getPath() const;
     fs::path getRootPath() const;
+    fs::path getScope() const override;
     void run() override;
 };
 
@@ -78,6 +79,7 @@ public:
         fs::path path,
         bool rescanResource,
         bool all);
+    fs::path getScope() const override;
     void run() override;
 };
 
@@ -94,6 +96,7 @@ public:
         std::shared_ptr<AutoscanDirectory> adir,
         int containerId,
         bool cancellable);
+    fs::path getScope() const override;
     void run() override;
 };
 
@@ -93,7 +93,9 @@ ContentManager::ContentManager(const std::shared_ptr<Context>& context,
     , context(context)
     , timer(std::move(timer))
 #ifdef HAVE_JS
-    , scriptingRuntime(std::make_shared<ScriptingRuntime>())
+    , scriptingRuntime(std::make_shared<ScriptingRuntime>(config->getIntOption(ConfigVal::IMPORT_SCRIPTING_HEAP_COUNT),
+          config->getBoolOption(ConfigVal::IMPORT_SCRIPTING_BYTECODE_CACHE) ? fs::path(config->getOption(ConfigVal::SERVER_HOME)) / "script-cache" : fs::path(),
+          config->getOption(ConfigVal::IMPORT_SCRIPTING_CHARSET)))
 #endif
 #ifdef HAVE_LASTFM
     , last_fm(std::make_shared<LastFm>(context))
@@ -148,6 +150,9 @@ void ContentManager::run()
     if (!threadRunner->isAlive()) {
         throw_std_runtime_error("Could not start ContentTaskThread thread");
     }
+    for (int worker = 1; worker < config->getIntOption(ConfigVal::IMPORT_TASK_THREADS); worker++) {
+        taskWorkers.push_back(std::make_unique<StdThreadRunner>(fmt::format("ContentTaskThread{}", worker), [this](void*) { taskProc(); }, nullptr));
+    }
 
     log_debug("updateAutoscanList {} ui", AutoscanScanMode::Timed);
     autoscanList = database->getAutoscanList(AutoscanScanMode::Timed);
@@ -341,11 +346,15 @@ void ContentManager::shutdown()
     }
 
     log_debug("signalling...");
-    threadRunner->notify();
+    threadRunner->notifyAll();
     lock.unlock();
     log_debug("waiting for thread...");
 
     threadRunner->join();
+    for (auto&& worker : taskWorkers) {
+        worker->join();
+    }
+    taskWorkers.clear();
 
 #ifdef HAVE_LASTFM
     last_fm->shutdown();
@@ -368,7 +377,8 @@ std::shared_ptr<GenericTask> ContentManager::getCurrentTask() const
 {
     auto lock = threadRunner->lockGuard("getCurrentTask");
 
-    return currentTask;
+    auto&& running = taskQueue.getRunning();
+    return running.empty() ? nullptr : running.front();
 }
 
 std::deque<std::shared_ptr<GenericTask>> ContentManager::getTasklist()
@@ -379,19 +389,12 @@ std::deque<std::shared_ptr<GenericTask>> ContentManager::getTasklist()
 #ifdef ONLINE_SERVICES
     taskList = task_processor->getTasklist();
 #endif
-    auto t = getCurrentTask();
-
-    // if there is no current task, then the queues are empty
-    // therefore we do not have to allocate the array
-    if (!t)
-        return taskList;
-
-    taskList.push_back(std::move(t));
-    std::copy_if(taskQueue1.begin(), taskQueue1.end(), std::back_inserter(taskList), [](auto&& task) { return task->isValid(); });
-
-    for (auto&& task : taskQueue2) {
-        if (task->isValid())
-            taskList.clear();
+    // queued tasks may wait while no worker is running, e.g. right after they were added
+    auto&& running = taskQueue.getRunning();
+    std::copy(running.begin(), running.end(), std::back_inserter(taskList));
+    for (bool lowPriority : { false, true }) {
+        auto&& queue = taskQueue.getQueue(lowPriority);
+        std::copy_if(queue.begin(), queue.end(), std::back_inserter(taskList), [](auto&& task) { return task->isValid(); });
     }
 
     return taskList;
@@ -1342,52 +1345,44 @@ void ContentManager::destroyLayout()
 
 void ContentManager::threadProc()
 {
-    std::shared_ptr<GenericTask> task;
     ThreadRunner<std::condition_variable_any, std::recursive_mutex>::waitFor("ContentManager", [this] { return threadRunner != nullptr; });
-    auto lock = threadRunner->uniqueLockS("threadProc");
-
-    // tell run() that we are ready
-    threadRunner->setReady();
+    {
+        auto lock = threadRunner->uniqueLockS("threadProc");
+        // tell run() that we are ready
+        threadRunner->setReady();
+    }
+    taskProc();
+}
 
-    working = true;
+void ContentManager::taskProc()
+{
+    auto lock = threadRunner->uniqueLockS("taskProc");
     while (!shutdownFlag) {
-        currentTask = nullptr;
-
-        task = nullptr;
-        if (!taskQueue1.empty()) {
-            task = std::move(taskQueue1.front());
-            taskQueue1.pop_front();
-        } else if (!taskQueue2.empty()) {
-            task = std::move(taskQueue2.front());
-            taskQueue2.pop_front();
-        }
-
+        auto task = taskQueue.start();
         if (!task) {
-            working = false;
             /* if nothing to do, sleep until awakened */
             threadRunner->wait(lock);
-            working = true;
             continue;
         }
-
-        currentTask = std::move(task);
         lock.unlock();
 
-        log_debug("content manager Async START {}", currentTask->getDescription());
+        log_debug("content manager Async START {}", task->getDescription());
         try {
-            if (currentTask->isValid())
-                currentTask->run();
+            if (task->isValid())
+                task->run();
         } catch (const ServerShutdownException&) {
             shutdownFlag = true;
         } catch (const std::runtime_error& e) {
             log_error("Exception caught: {}", e.what());
         }
-        log_debug("content manager ASYNC STOP  {}", currentTask->getDescription());
+        log_debug("content manager ASYNC STOP  {}", task->getDescription());
 
-        if (!shutdownFlag) {
-            lock.lock();
-        }
+        lock.lock();
+        taskQueue.finish(task);
+        // tasks waiting for this one can be started by any thread
+        threadRunner->notifyAll();
     }
+    lock.unlock();
 
     database->threadCleanup();
 }
@@ -1397,11 +1392,7 @@ void ContentManager::addTask(std::shared_ptr<GenericTask> task, bool lowPriority
     auto lock = threadRunner->lockGuard("addTask");
 
     task->setID(taskID++);
-
-    if (!lowPriority)
-        taskQueue1.push_back(std::move(task));
-    else
-        taskQueue2.push_back(std::move(task));
+    taskQueue.push(std::move(task), lowPriority);
     threadRunner->notify();
 }
 
@@ -1513,19 +1504,15 @@ void ContentManager::invalidateTask(unsigned int taskID, TaskOwner taskOwner)
 {
     if (taskOwner == TaskOwner::ContentManagerTask) {
         auto lock = threadRunner->lockGuard("invalidateTask");
-        auto tc = getCurrentTask();
-        if (tc && ((tc->getID() == taskID) || (tc->getParentID() == taskID)))
-            tc->invalidate();
-
-        for (auto&& t1 : taskQueue1) {
-            if ((t1->getID() == taskID) || (t1->getParentID() == taskID))
-                t1->invalidate();
-        }
-
-        for (auto&& t2 : taskQueue2) {
-            if ((t2->getID() == taskID) || (t2->getParentID() == taskID))
-                t2->invalidate();
-        }
+        auto invalidate = [taskID](auto&& tasks) {
+            for (auto&& t : tasks) {
+                if ((t->getID() == taskID) || (t->getParentID() == taskID))
+                    t->invalidate();
+            }
+        };
+        invalidate(taskQueue.getRunning());
+        invalidate(taskQueue.getQueue(false));
+        invalidate(taskQueue.getQueue(true));
     }
 #ifdef ONLINE_SERVICES
     else if (taskOwner == TaskOwner::TaskProcessorTask)
@@ -1577,16 +1564,15 @@ void ContentManager::cleanupTasks(const fs::path& path)
 
     // we have to make sure that a currently running autoscan task will not
     // launch add tasks for directories that anyway are going to be deleted
-    for (auto&& t : taskQueue1) {
+    for (auto&& t : taskQueue.getQueue(false)) {
         invalidateAddTask(t, path);
     }
 
-    for (auto&& t : taskQueue2) {
+    for (auto&& t : taskQueue.getQueue(true)) {
         invalidateAddTask(t, path);
     }
 
-    auto t = getCurrentTask();
-    if (t) {
+    for (auto&& t : taskQueue.getRunning()) {
         invalidateAddTask(t, path);
     }
 }
@@ -1762,6 +1748,7 @@ void ContentManager::triggerPlayHook(const std::string& group, const std::shared
     playStatus->increasePlayCount();
     playStatus->setLastPlayed();
     database->savePlayStatus(playStatus);
+    update_manager->resultsChanged();
 
     bool suppress = config->getBoolOption(ConfigVal::SERVER_EXTOPTS_MARK_PLAYED_ITEMS_ENABLED) && config->getBoolOption(ConfigVal::SERVER_EXTOPTS_MARK_PLAYED_ITEMS_SUPPRESS_CDS_UPDATES);
     log_debug("Marking object {} as played", obj->getTitle());
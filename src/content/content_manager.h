@@ -34,9 +34,11 @@
 #define __CONTENT_MANAGER_H__
 
 #include "content.h"
+#include "content_task_queue.h"
 #include "util/executor.h"
 #include "util/thread_runner.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <vector>
@@ -374,17 +376,18 @@ protected:
     ImportMode importMode = ImportMode::MediaTomb;
     bool layoutEnabled {};
     void threadProc();
+    /// @brief run tasks until shutdown, called by all task threads
+    void taskProc();
 
     void addTask(std::shared_ptr<GenericTask> task, bool lowPriority = false);
 
     std::unique_ptr<ThreadRunner<std::condition_variable_any, std::recursive_mutex>> threadRunner;
+    /// @brief additional threads running tasks of other autoscan directories
+    std::vector<std::unique_ptr<StdThreadRunner>> taskWorkers;
 
-    bool working {};
-    bool shutdownFlag {};
+    std::atomic_bool shutdownFlag {};
 
-    std::deque<std::shared_ptr<GenericTask>> taskQueue1; // priority 1
-    std::deque<std::shared_ptr<GenericTask>> taskQueue2; // priority 2
-    std::shared_ptr<GenericTask> currentTask;
+    ContentTaskQueue taskQueue;
 
     unsigned int taskID { 1 };
 
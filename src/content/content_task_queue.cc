@@ -0,0 +1,79 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    content_task_queue.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/content_task_queue.cc
+#define GRB_LOG_FAC GrbLogFacility::content
+
+#include "content_task_queue.h" // API
+
+#include "util/generic_task.h"
+
+#include <algorithm>
+
+void ContentTaskQueue::push(std::shared_ptr<GenericTask> task, bool lowPriority)
+{
+    if (!lowPriority)
+        taskQueue1.push_back(std::move(task));
+    else
+        taskQueue2.push_back(std::move(task));
+}
+
+bool ContentTaskQueue::overlaps(const fs::path& first, const fs::path& second)
+{
+    return isSubDir(first, second) || isSubDir(second, first);
+}
+
+std::shared_ptr<GenericTask> ContentTaskQueue::start()
+{
+    // scopes of running tasks and of tasks that were skipped, a task must not overtake or join them
+    std::vector<fs::path> blocking;
+    for (auto&& task : running) {
+        auto scope = task->getScope();
+        if (scope.empty())
+            return nullptr;
+        if (std::find(blocking.begin(), blocking.end(), scope) == blocking.end())
+            blocking.push_back(std::move(scope));
+    }
+
+    for (auto queue : { &taskQueue1, &taskQueue2 }) {
+        for (auto it = queue->begin(); it != queue->end(); ++it) {
+            auto scope = (*it)->getScope();
+            if (scope.empty() && !blocking.empty())
+                return nullptr; // waits for all others and blocks all later tasks
+            if (std::none_of(blocking.begin(), blocking.end(), [&scope](auto&& other) { return overlaps(scope, other); })) {
+                auto result = std::move(*it);
+                queue->erase(it);
+                running.push_back(result);
+                return result;
+            }
+            if (std::find(blocking.begin(), blocking.end(), scope) == blocking.end())
+                blocking.push_back(std::move(scope));
+        }
+    }
+    return nullptr;
+}
+
+void ContentTaskQueue::finish(const std::shared_ptr<GenericTask>& task)
+{
+    running.erase(std::remove(running.begin(), running.end(), task), running.end());
+}
@@ -0,0 +1,67 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    content_task_queue.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/content_task_queue.h
+/// @brief Definition of the ContentTaskQueue class.
+
+#ifndef __CONTENT_TASK_QUEUE_H__
+#define __CONTENT_TASK_QUEUE_H__
+
+#include "util/grb_fs.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+class GenericTask;
+
+/// @brief Queues of content tasks that are handed out to several workers
+///
+/// Tasks with the same or nested scope are started in the order they were added and never run at the same time.
+/// Tasks without scope run alone. High priority tasks are started before low priority tasks.
+/// The queue is not thread-safe, the owner has to lock it.
+class ContentTaskQueue {
+public:
+    /// @brief add task to the end of its queue
+    void push(std::shared_ptr<GenericTask> task, bool lowPriority);
+    /// @brief take the first queued task that can run next to the running tasks
+    /// @return nullptr if there is none
+    std::shared_ptr<GenericTask> start();
+    /// @brief remove task from the running tasks
+    void finish(const std::shared_ptr<GenericTask>& task);
+
+    /// @brief tasks that were started and are not finished, oldest first
+    const std::vector<std::shared_ptr<GenericTask>>& getRunning() const { return running; }
+    /// @brief tasks that wait to be started
+    const std::deque<std::shared_ptr<GenericTask>>& getQueue(bool lowPriority) const { return lowPriority ? taskQueue2 : taskQueue1; }
+
+private:
+    /// @brief check whether tasks with these scopes must not run at the same time
+    static bool overlaps(const fs::path& first, const fs::path& second);
+
+    std::deque<std::shared_ptr<GenericTask>> taskQueue1; // priority 1
+    std::deque<std::shared_ptr<GenericTask>> taskQueue2; // priority 2
+    std::vector<std::shared_ptr<GenericTask>> running;
+};
+
+#endif // __CONTENT_TASK_QUEUE_H__
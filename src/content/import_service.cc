@@ -41,6 +41,7 @@
 #include "metadata/metadata_service.h"
 #include "util/mime.h"
 #include "util/string_converter.h"
+#include "util/thread_runner.h"
 #include "util/tools.h"
 
 #ifdef HAVE_JS
@@ -52,7 +53,11 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <fmt/chrono.h>
+#include <functional>
 #include <regex>
 
 bool UpnpMap::checkValue(const std::string& op, const std::string& expect, const std::string& actual) const
@@ -250,6 +255,7 @@ ImportService::ImportService(std::shared_ptr<Context> context, std::shared_ptr<C
     , mime(this->context->getMime())
     , database(this->context->getDatabase())
     , converterManager(std::move(converterManager))
+    , layoutMapping(this->config->getDictionaryOption(ConfigVal::IMPORT_LAYOUT_MAPPING))
     , containerTypeMap(AutoscanDirectory::ContainerTypesDefaults)
     , importStateCache(std::make_shared<StateCache>())
     , containerCache(this->config->getBoolOption(ConfigVal::IMPORT_CASE_SENSITIVE_TAGS))
@@ -259,11 +265,15 @@ ImportService::ImportService(std::shared_ptr<Context> context, std::shared_ptr<C
     hasDefaultDate = config->getBoolOption(ConfigVal::IMPORT_DEFAULT_DATE);
     mimetypeContenttypeMap = config->getDictionaryOption(ConfigVal::IMPORT_MAPPINGS_MIMETYPE_TO_CONTENTTYPE_LIST);
     mimetypeUpnpclassMap = config->getDictionaryOption(ConfigVal::IMPORT_MAPPINGS_MIMETYPE_TO_UPNP_CLASS_LIST);
-    configLayoutMapping = config->getDictionaryOption(ConfigVal::IMPORT_LAYOUT_MAPPING);
     containerImageParentCount = config->getIntOption(ConfigVal::IMPORT_RESOURCES_CONTAINERART_PARENTCOUNT);
     containerImageMinDepth = config->getIntOption(ConfigVal::IMPORT_RESOURCES_CONTAINERART_MINDEPTH);
     virtualDirKeys = config->getVectorOption(ConfigVal::IMPORT_VIRTUAL_DIRECTORY_KEYS);
     noMediaName = config->getOption(ConfigVal::IMPORT_NOMEDIA_FILE);
+    metadataThreads = config->getIntOption(ConfigVal::IMPORT_METADATA_THREADS);
+    scanThreads = config->getIntOption(ConfigVal::IMPORT_SCAN_THREADS);
+    importBatchSize = config->getIntOption(ConfigVal::IMPORT_BATCH_SIZE);
+    usePathIndex = config->getBoolOption(ConfigVal::IMPORT_PATH_INDEX);
+    pruneUnchangedDirs = config->getBoolOption(ConfigVal::IMPORT_PRUNE_UNCHANGED_DIRS);
     UpnpMap::initMap(upnpMap, mimetypeUpnpclassMap);
 }
 
@@ -349,7 +359,19 @@ std::string ImportService::mimeTypeToUpnpClass(const std::string& mimeType) cons
 void ImportService::clearCache()
 {
     log_debug("Clearing Cache '{}'", rootPath.c_str());
+    auto treeLock = std::scoped_lock(containerTreeMutex);
     containerCache.clear();
+    // scripts must not hand out removed or changed containers as parent
+    if (layout)
+        layout->clearCache();
+#ifdef HAVE_JS
+    if (playlistParserScript)
+        playlistParserScript->clearParentCache();
+    if (metafileParserScript)
+        metafileParserScript->clearParentCache();
+    if (cuesheetParserScript)
+        cuesheetParserScript->clearParentCache();
+#endif
 }
 
 std::shared_ptr<CdsObject> ImportService::doImport(
@@ -360,7 +382,8 @@ std::shared_ptr<CdsObject> ImportService::doImport(
 {
     auto stateCache = std::make_shared<StateCache>();
     log_debug("start {} root '{}' update {}", location.string(), rootPath.string(), !!settings.changedObject);
-    if (activeScan.empty()) {
+    bool isFirstScan = activeScan.empty();
+    if (isFirstScan) {
         if (settings.changedObject || !autoscanDir || autoscanDir->getScanMode() != AutoscanScanMode::INotify)
             clearCache();
         activeScan = location;
@@ -386,8 +409,11 @@ std::shared_ptr<CdsObject> ImportService::doImport(
     }
 
     stateCache->cacheState(location, rootEntry, ImportState::New, toSeconds(rootEntry.last_write_time(ec)), settings.changedObject);
+    // single changes are cheaper to look up one by one than loading the whole tree
+    if (usePathIndex && isFirstScan && isDir && !settings.changedObject)
+        pathIndex.load(database, location);
     if (isDir) {
-        readDir(stateCache, location, settings);
+        readTree(stateCache, location, settings);
     } else {
         readFile(stateCache, location);
     }
@@ -408,8 +434,33 @@ std::shared_ptr<CdsObject> ImportService::doImport(
             }
         }
     }
+    // files of unchanged folders were not read but still exist
+    for (auto&& dirPath : stateCache->unchangedDirs) {
+        auto container = stateCache->getObject(dirPath);
+        if (!container || currentContent.empty())
+            continue;
+        std::unordered_set<int> dirContent;
+        database->getObjects(container->getID(), true, dirContent, false, INVALID_OBJECT_ID);
+        for (auto&& objectId : dirContent)
+            currentContent.erase(objectId);
+    }
+    // folders that failed to be read are not removed
+    for (auto&& dirPath : stateCache->brokenDirs) {
+        auto container = database->findObjectByPath(dirPath, UNUSED_CLIENT_GROUP, DbFileType::Directory);
+        if (!container || currentContent.empty())
+            continue;
+        currentContent.erase(container->getID());
+        std::unordered_set<int> dirContent;
+        database->getObjects(container->getID(), true, dirContent, false, INVALID_OBJECT_ID);
+        for (auto&& objectId : dirContent)
+            currentContent.erase(objectId);
+    }
     if (!currentContent.empty())
         clearCache();
+    if (autoscanDir) {
+        for (auto&& [dirPath, dirModified] : stateCache->dirModified)
+            autoscanDir->setDirModified(dirPath, dirModified);
+    }
 
     log_debug("import of {} left {} item(s) to be deleted", location.c_str(), currentContent.size());
 
@@ -417,42 +468,190 @@ std::shared_ptr<CdsObject> ImportService::doImport(
         log_debug("Updating last_modified for autoscan directory {}", autoscanDir->getLocation().c_str());
         database->updateAutoscanDirectory(autoscanDir);
     }
-    if (activeScan == location)
+    if (activeScan == location) {
         activeScan.clear();
+        pathIndex.clear();
+    }
     if (importStateCache->contentStateCache.size() < stateCache->contentStateCache.size())
         importStateCache = stateCache;
     return stateCache->getObject(location);
 }
 
+bool ImportService::isUnchangedDir(const fs::path& location, fs::file_time_type lastModified, const AutoScanSetting& settings) const
+{
+    if (!pruneUnchangedDirs || !autoscanDir || autoscanDir->getScanMode() != AutoscanScanMode::Timed || autoscanDir->getForceRescan() || settings.changedObject)
+        return false;
+    return autoscanDir->isUnchangedDir(location, lastModified);
+}
+
+/// @brief run proc on the calling thread and on threadCount - 1 worker threads, return when all of them finished
+static void runWorkers(const std::string& name, std::size_t threadCount, const std::function<void()>& proc)
+{
+    auto workerProc = [&name, &proc](void*) {
+        try {
+            proc();
+        } catch (const std::exception& ex) {
+            log_error("{} failed: {}", name, ex.what());
+        }
+    };
+
+    // calling thread is the first worker
+    std::vector<std::unique_ptr<StdThreadRunner>> workers;
+    for (std::size_t worker = 1; worker < threadCount; worker++) {
+        workers.push_back(std::make_unique<StdThreadRunner>(fmt::format("{}{}", name, worker), workerProc, nullptr));
+    }
+    workerProc(nullptr);
+    for (auto&& worker : workers) {
+        worker->join();
+    }
+}
+
+/// @brief run job for each index below jobCount with up to threadCount threads, a failing job does not stop the others
+static void runJobs(const std::string& name, std::size_t threadCount, std::size_t jobCount, const std::function<void(std::size_t)>& job)
+{
+    std::atomic_size_t nextJob = 0;
+    runWorkers(name, std::min(threadCount, jobCount), [&name, &job, &nextJob, jobCount]() {
+        for (auto index = nextJob++; index < jobCount; index = nextJob++) {
+            try {
+                job(index);
+            } catch (const std::exception& ex) {
+                log_error("{} job {} failed: {}", name, index, ex.what());
+            }
+        }
+    });
+}
+
+struct ImportService::PendingDir {
+    fs::path location;
+    AutoScanSetting settings;
+    bool parentUnchanged;
+    std::optional<fs::file_time_type> modified;
+};
+
+void ImportService::readTree(
+    const std::shared_ptr<StateCache>& stateCache,
+    const fs::path& location, const AutoScanSetting& settings)
+{
+    if (scanThreads <= 1 || !settings.recursive) {
+        readDir(stateCache, location, settings);
+        return;
+    }
+
+    // folders are read in any order, the state cache is sorted by path so the result does not depend on it
+    auto start = std::chrono::steady_clock::now();
+    std::deque<PendingDir> pending { PendingDir { location, settings, true } };
+    std::size_t activeReads = 0;
+    std::size_t dirCount = 0;
+    std::mutex pendingMutex;
+    std::condition_variable pendingCond;
+    auto readProc = [this, &stateCache, &pending, &activeReads, &dirCount, &pendingMutex, &pendingCond]() {
+        std::unique_lock<std::mutex> lock(pendingMutex);
+        while (true) {
+            pendingCond.wait(lock, [&] { return !pending.empty() || activeReads == 0; });
+            if (pending.empty())
+                break;
+            auto dir = std::move(pending.front());
+            pending.pop_front();
+            activeReads++;
+            dirCount++;
+            lock.unlock();
+
+            std::vector<PendingDir> subDirs;
+            try {
+                readDir(stateCache, dir.location, dir.settings, dir.parentUnchanged, &subDirs, dir.modified);
+            } catch (const std::exception& ex) {
+                log_error("Failed to read {}: {}", dir.location.c_str(), ex.what());
+                auto cacheLock = StateCache::CacheAutoLock(stateCache->cacheMutex);
+                stateCache->brokenDirs.push_back(dir.location);
+            }
+
+            lock.lock();
+            activeReads--;
+            for (auto&& subDir : subDirs)
+                pending.push_back(std::move(subDir));
+            pendingCond.notify_all();
+        }
+    };
+
+    runWorkers("ScanWorker", scanThreads, readProc);
+    {
+        auto cacheLock = StateCache::CacheAutoLock(stateCache->cacheMutex);
+        std::sort(stateCache->unchangedDirs.begin(), stateCache->unchangedDirs.end());
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    log_info("Read {} folder(s) of {} in {} ms with {} thread(s)", dirCount, location.string(), duration.count(), scanThreads);
+}
+
 void ImportService::readDir(
     const std::shared_ptr<StateCache>& stateCache,
-    const fs::path& location, AutoScanSetting settings)
+    const fs::path& location, AutoScanSetting settings, bool parentUnchanged, std::vector<PendingDir>* subDirs, std::optional<fs::file_time_type> modified)
 {
     log_debug("start {}", location.string());
+    // may run on several threads
+    std::error_code ec;
+    // taken before reading, so changes while reading are found next time
+    if (!modified) {
+        auto dirModified = fs::last_write_time(location, ec);
+        if (!ec)
+            modified = dirModified;
+    }
+    auto hasModified = modified.has_value();
+    auto dirModified = modified.value_or(fs::file_time_type::min());
     auto dirIterator = fs::directory_iterator(location, ec);
     if (ec) {
         log_error("Failed to iterate {}, {}", location.c_str(), ec.message());
         return;
     }
     settings.mergeOptions(config, location);
-    for (auto&& dirEntry : dirIterator) {
+    // adding or removing files changes the folder, so only subfolders must be checked
+    auto isUnchanged = parentUnchanged && hasModified && isUnchangedDir(location, dirModified, settings);
+    if (isUnchanged) {
+        log_debug("Skipping files of unchanged {}", location.string());
+        auto cacheLock = StateCache::CacheAutoLock(stateCache->cacheMutex);
+        stateCache->unchangedDirs.push_back(location);
+    }
+    // errors of network shares are reported when advancing, one failing entry must not stop the import
+    std::error_code iterEc;
+    for (; dirIterator != fs::directory_iterator(); dirIterator.increment(iterEc)) {
+        auto&& dirEntry = *dirIterator;
         auto&& entryPath = dirEntry.path();
-        if (entryPath.empty() || isHiddenFile(entryPath, true, dirEntry, settings)) {
+        if (entryPath.empty())
+            continue;
+        // files of unchanged folder are kept without reading them
+        if (isUnchanged && !dirEntry.is_directory(ec) && entryPath.filename() != noMediaName)
+            continue;
+        if (isHiddenFile(entryPath, true, dirEntry, settings)) {
             continue;
         }
-        stateCache->cacheState(entryPath, dirEntry, ImportState::New, toSeconds(dirEntry.last_write_time(ec)));
+        // directory_entry only caches the file type, the modification time needs a stat of the entry
+        auto entryModified = dirEntry.last_write_time(ec);
+        auto subDirModified = ec ? std::nullopt : std::make_optional(entryModified);
+        stateCache->cacheState(entryPath, dirEntry, ImportState::New, toSeconds(entryModified));
         if (dirEntry.is_directory(ec) && settings.recursive) {
-            if (!ec) {
-                readDir(stateCache, entryPath, settings);
-            } else {
+            if (ec) {
                 stateCache->cacheState(entryPath, dirEntry, ImportState::Broken);
                 log_error("ImportService::readDir {}: Failed to read {}, {}", location.c_str(), entryPath.c_str(), ec.message());
+            } else if (subDirs) {
+                subDirs->push_back(PendingDir { entryPath, settings, isUnchanged, subDirModified });
+            } else {
+                readDir(stateCache, entryPath, settings, isUnchanged, nullptr, subDirModified);
             }
         } else if (ec) {
             stateCache->cacheState(entryPath, dirEntry, ImportState::Broken);
             log_error("ImportService::readDir {}: Failed to read {}, {}", location.c_str(), entryPath.c_str(), ec.message());
         }
     }
+    if (iterEc) {
+        // read again on next scan and keep the known content
+        log_error("ImportService::readDir {}: Failed to read folder completely, {}", location.c_str(), iterEc.message());
+        stateCache->cacheState(location, fs::directory_entry(location, ec), ImportState::Broken);
+        auto cacheLock = StateCache::CacheAutoLock(stateCache->cacheMutex);
+        stateCache->brokenDirs.push_back(location);
+    } else if (hasModified && pruneUnchangedDirs) {
+        auto cacheLock = StateCache::CacheAutoLock(stateCache->cacheMutex);
+        stateCache->dirModified.emplace_back(location, dirModified);
+    }
     log_debug("end {}", location.string());
 }
 
@@ -562,8 +761,11 @@ void ImportService::createContainers(
                             childEntry->setObject(ImportState::New, childObj);
                     }
                 }
+                pathIndex.remove(oldLocation);
+                pathIndex.add(cdsObj);
             }
-            if (!cdsObj)
+            // containers are loaded completely because they are updated, the index only saves the lookup of new ones
+            if (!cdsObj && (!pathIndex.covers(contPath) || pathIndex.find(contPath)))
                 cdsObj = database->findObjectByPath(contPath, UNUSED_CLIENT_GROUP, DbFileType::Directory);
 
             if (cdsObj) {
@@ -591,7 +793,10 @@ void ImportService::createContainers(
                 }
             } else {
                 // Create container
-                stateEntry->setObject(ImportState::Created, createSingleContainer(parentContainerId, dirEntry, UPNP_CLASS_CONTAINER_FOLDER));
+                auto container = createSingleContainer(parentContainerId, dirEntry, UPNP_CLASS_CONTAINER_FOLDER);
+                if (container)
+                    pathIndex.add(container);
+                stateEntry->setObject(ImportState::Created, container);
             }
         }
     }
@@ -625,16 +830,177 @@ std::tuple<bool, std::string, std::string> ImportService::getMimeForFile(const f
     return { skip, mimetype, upnpClass };
 }
 
+bool ImportService::ItemJob::needsExtraction() const
+{
+    return !cdsObj || !cdsObj->isItem() || isChanged;
+}
+
+/// @brief find existing objects and prepare changed items for update
+std::map<fs::path, ImportService::ItemJob> ImportService::prepareItems(const std::shared_ptr<StateCache>& stateCache)
+{
+    std::map<fs::path, ItemJob> jobs;
+    for (auto&& [itemPath, stateEntry] : stateCache->contentStateCache) {
+        if (!stateEntry || stateEntry->getState() != ImportState::New)
+            continue;
+        auto dirEntry = stateEntry->getDirEntry();
+        if (!isRegularFile(dirEntry, ec))
+            continue;
+
+        auto& job = jobs[itemPath];
+        job.dirEntry = dirEntry;
+        job.cdsObj = stateEntry->getObject();
+        bool fromIndex = false;
+        if (!job.cdsObj && pathIndex.covers(itemPath)) {
+            // Search item in index, objects not in index are not in database
+            auto pathEntry = pathIndex.find(itemPath);
+            if (pathEntry && pathEntry->entryType == CdsEntryType::File) {
+                job.cdsObj = PathIndex::createObject(itemPath, pathEntry.value());
+                fromIndex = true;
+            }
+        } else if (!job.cdsObj) {
+            // Search item in database
+            log_debug("Searching Item {} in database", itemPath.string());
+            job.cdsObj = database->findObjectByPath(itemPath, UNUSED_CLIENT_GROUP, DbFileType::File);
+        }
+        if (!job.cdsObj || !job.cdsObj->isItem())
+            continue;
+
+        auto cdsObj = job.cdsObj;
+        job.isChanged = stateEntry->getMTime() != cdsObj->getMTime() || cdsObj->getLocation().string() != dirEntry.path().string();
+        if (autoscanDir && autoscanDir->getForceRescan())
+            job.isChanged = job.isChanged || cdsObj->getClass().empty() || cdsObj->getClass() == UPNP_CLASS_ITEM;
+        if (!job.isChanged)
+            continue;
+
+        if (fromIndex) {
+            // index only holds the values to detect changes
+            try {
+                cdsObj = database->loadObject(cdsObj->getID());
+                job.cdsObj = cdsObj;
+            } catch (const ObjectNotFoundException&) {
+                log_debug("Item {} removed from database {}", itemPath.string(), cdsObj->getID());
+                job.cdsObj = nullptr;
+                continue;
+            }
+            if (!cdsObj->isItem())
+                continue;
+        }
+
+        log_debug("Preparing update of Item {} in database {}", itemPath.string(), cdsObj->getID());
+        auto item = std::dynamic_pointer_cast<CdsItem>(cdsObj);
+        if (item->getMimeType().empty() || item->getClass().empty() || item->getClass() == UPNP_CLASS_ITEM) {
+            auto [skip, mimetype, upnpClass] = getMimeForFile(itemPath);
+            if (!mimetype.empty()) {
+                item->setMimeType(mimetype);
+            }
+            if (!upnpClass.empty()) {
+                item->setClass(upnpClass);
+            }
+            log_debug("Updating Item properties {} in database: skip {} mimeType {}, upnpClass {}", skip, itemPath.string(), mimetype, upnpClass);
+        }
+        item->clearMetaData();
+        item->clearAuxData();
+        item->clearResources();
+        // get ref'd objects with last mod time
+        auto refDirs = database->getRefObjects(item->getID(), CdsEntryType::ExtraDirectory);
+        for (auto refDir : refDirs) {
+            database->getObjects(refDir, true, job.refObjects, false, INVALID_OBJECT_ID);
+        }
+        log_debug("Changing location {} to {}", item->getLocation().string(), itemPath.string());
+        item->setLocation(itemPath, CdsEntryType::File);
+        item->setTitle(makeTitle(itemPath, item->getClass()));
+        auto sortKey = expandNumbersString(itemPath.filename().stem().string());
+        if (!sortKey.empty()) {
+            item->setSortKey(sortKey);
+        }
+        job.item = item;
+    }
+    return jobs;
+}
+
+/// @brief read metadata for a single job, may run on worker thread
+void ImportService::extractSingleItem(ItemJob& job)
+{
+    try {
+        if (job.isChanged) {
+            updateSingleItem(job.dirEntry, job.item, job.item->getMimeType());
+        } else {
+            auto [skip, newCdsObj] = createSingleItem(job.dirEntry);
+            job.skip = skip;
+            job.item = std::static_pointer_cast<CdsItem>(newCdsObj);
+        }
+    } catch (const std::exception& ex) {
+        log_error("Reading metadata of {} failed: {}", job.dirEntry.path().string(), ex.what());
+        if (!job.isChanged)
+            job.item = nullptr;
+    }
+}
+
+/// @brief read metadata for all pending jobs with up to metadataThreads threads
+void ImportService::extractItems(std::map<fs::path, ItemJob>& jobs)
+{
+    std::vector<ItemJob*> pending;
+    pending.reserve(jobs.size());
+    for (auto&& [itemPath, job] : jobs) {
+        if (job.needsExtraction())
+            pending.push_back(&job);
+    }
+    if (pending.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    auto threadCount = std::min(static_cast<std::size_t>(metadataThreads), pending.size());
+    runJobs("MetadataWorker", threadCount, pending.size(), [this, &pending](std::size_t index) { extractSingleItem(*pending.at(index)); });
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    log_info("Read metadata of {} file(s) in {} ms with {} thread(s): {:.1f} files/s", pending.size(), duration.count(), threadCount,
+        pending.size() * 1000.0 / std::max<decltype(duration.count())>(duration.count(), 1));
+}
+
+/// @brief write pending new items to database and run post creation handlers
+void ImportService::flushNewItems(
+    const std::shared_ptr<StateCache>& stateCache,
+    std::vector<std::pair<std::shared_ptr<CdsItem>, fs::directory_entry>>& newItems)
+{
+    if (newItems.empty())
+        return;
+
+    std::vector<std::shared_ptr<CdsObject>> objects;
+    objects.reserve(newItems.size());
+    for (auto&& [item, dirEntry] : newItems) {
+        objects.push_back(item);
+    }
+    database->addObjects(objects, nullptr);
+    for (auto&& object : objects)
+        pathIndex.add(object);
+
+    for (auto&& [item, dirEntry] : newItems) {
+        std::vector<int> newIds;
+        if (metadataService->afterCreation(item, dirEntry, newIds)) {
+            addExtraObjects(stateCache, newIds);
+            database->updateObject(item, nullptr);
+        }
+    }
+    newItems.clear();
+}
+
 /// @brief create items for all discovered files
 void ImportService::createItems(
     const std::shared_ptr<StateCache>& stateCache,
     AutoScanSetting& settings)
 {
     log_debug("start {}", rootPath.string());
+    // metadata is read before touching the database so the expensive part can run in parallel
+    auto jobs = prepareItems(stateCache);
+    extractItems(jobs);
+
     std::shared_ptr<CdsContainer> parentContainer = nullptr;
     auto lastModifiedCurrentMax = std::chrono::seconds::zero();
     auto lastModifiedNewMax = lastModifiedCurrentMax;
     fs::path contPath;
+    // new items are written in batches
+    std::vector<std::pair<std::shared_ptr<CdsItem>, fs::directory_entry>> newItems;
+    newItems.reserve(importBatchSize);
 
     for (auto&& [itemPath, stateEntry] : stateCache->contentStateCache) {
         if (!stateEntry) {
@@ -665,7 +1031,10 @@ void ImportService::createItems(
         }
         // create items from files
         auto dirEntry = stateEntry->getDirEntry();
-        if (isRegularFile(dirEntry, ec)) {
+        auto jobEntry = jobs.find(itemPath);
+        if (jobEntry != jobs.end()) {
+            auto& job = jobEntry->second;
+            cdsObj = job.cdsObj;
             // Start with cached item
             auto contState = stateCache->contentStateCache.at(itemPath.parent_path());
             if (contState)
@@ -673,53 +1042,20 @@ void ImportService::createItems(
             else
                 log_error("No Container parent for Item {}", itemPath.string());
 
-            if (!cdsObj) {
-                // Search item in database
-                log_debug("Searching Item {} in database", itemPath.string());
-                cdsObj = database->findObjectByPath(itemPath, UNUSED_CLIENT_GROUP, DbFileType::File);
-            }
             if (cdsObj && cdsObj->isItem()) {
-                auto isChanged = stateEntry->getMTime() != cdsObj->getMTime() || cdsObj->getLocation().string() != dirEntry.path().string();
-                if (autoscanDir && autoscanDir->getForceRescan())
-                    isChanged = isChanged || cdsObj->getClass().empty() || cdsObj->getClass() == UPNP_CLASS_ITEM;
-                if (isChanged) {
+                if (job.isChanged) {
+                    // keep database changes in order of the files
+                    flushNewItems(stateCache, newItems);
                     // Update changed item in database
                     log_debug("Updating Item {} in database {}", itemPath.string(), cdsObj->getID());
-                    auto item = std::dynamic_pointer_cast<CdsItem>(cdsObj);
-                    if (item->getMimeType().empty() || item->getClass().empty() || item->getClass() == UPNP_CLASS_ITEM) {
-                        auto [skip, mimetype, upnpClass] = getMimeForFile(itemPath);
-                        if (!mimetype.empty()) {
-                            item->setMimeType(mimetype);
-                        }
-                        if (!upnpClass.empty()) {
-                            item->setClass(upnpClass);
-                        }
-                        log_debug("Updating Item properties {} in database: skip {} mimeType {}, upnpClass {}", skip, itemPath.string(), mimetype, upnpClass);
-                    }
-                    item->clearMetaData();
-                    item->clearAuxData();
-                    item->clearResources();
-                    // get ref'd objects with last mod time
-                    auto refDirs = database->getRefObjects(item->getID(), CdsEntryType::ExtraDirectory);
-                    std::unordered_set<int> refObjects;
-                    for (auto refDir : refDirs) {
-                        database->getObjects(refDir, true, refObjects, false, INVALID_OBJECT_ID);
-                    }
-                    log_debug("Changing location {} to {}", item->getLocation().string(), itemPath.string());
-                    item->setLocation(itemPath, CdsEntryType::File);
-                    item->setTitle(makeTitle(itemPath, item->getClass()));
-                    auto sortKey = expandNumbersString(itemPath.filename().stem().string());
-                    if (!sortKey.empty()) {
-                        item->setSortKey(sortKey);
-                    }
-                    updateSingleItem(dirEntry, item, item->getMimeType());
+                    auto item = job.item;
                     if (lastModifiedNewMax < cdsObj->getMTime())
                         lastModifiedNewMax = cdsObj->getMTime();
                     std::vector<int> newIds;
                     if (metadataService->afterCreation(item, dirEntry, newIds))
                         addExtraObjects(stateCache, newIds);
                     database->updateObject(item, nullptr);
-                    for (auto&& origId : refObjects) {
+                    for (auto&& origId : job.refObjects) {
                         auto newEntry = std::find_if(newIds.begin(), newIds.end(), [&](const auto& entry) {
                             return origId == entry;
                         });
@@ -743,9 +1079,8 @@ void ImportService::createItems(
             } else {
                 // Create item from scratch
                 log_debug("Creating Item {}", itemPath.string());
-                auto [skip, newCdsObj] = createSingleItem(dirEntry);
-                if (newCdsObj) {
-                    cdsObj = newCdsObj;
+                if (job.item) {
+                    cdsObj = job.item;
                     if (contState) {
                         contState->setMTime(cdsObj->getMTime());
                         if (lastModifiedNewMax < cdsObj->getMTime())
@@ -753,15 +1088,13 @@ void ImportService::createItems(
                     }
                     stateEntry->setObject(ImportState::Created, cdsObj);
                     cdsObj->setParentID(parentContainer ? parentContainer->getID() : INVALID_OBJECT_ID);
-                    database->addObject(cdsObj, nullptr);
-                    std::vector<int> newIds;
-                    if (metadataService->afterCreation(std::static_pointer_cast<CdsItem>(cdsObj), dirEntry, newIds))
-                        addExtraObjects(stateCache, newIds);
-                    database->updateObject(cdsObj, nullptr);
+                    newItems.emplace_back(job.item, dirEntry);
+                    if (newItems.size() >= importBatchSize)
+                        flushNewItems(stateCache, newItems);
                 } else {
                     stateEntry->setObject(ImportState::Broken, cdsObj);
                     cdsObj = nullptr;
-                    if (!skip)
+                    if (!job.skip)
                         log_error("Object not created for file {}", dirEntry.path().string());
                 }
             }
@@ -776,6 +1109,7 @@ void ImportService::createItems(
             log_debug("Not a file {}", itemPath.string());
         }
     }
+    flushNewItems(stateCache, newItems);
     if (autoscanDir && contPath != "") {
         autoscanDir->setCurrentLMT(contPath, lastModifiedNewMax);
     }
@@ -830,7 +1164,8 @@ void ImportService::updateSingleItem(
     const std::shared_ptr<CdsItem>& item,
     const std::string& mimetype)
 {
-    auto mTime = toSeconds(dirEntry.last_write_time(ec));
+    std::error_code fileEc;
+    auto mTime = toSeconds(dirEntry.last_write_time(fileEc));
     item->setMTime(mTime);
     item->setUTime(mTime);
     item->setSizeOnDisk(getFileSize(dirEntry));
@@ -845,16 +1180,49 @@ void ImportService::updateSingleItem(
     }
 }
 
+/// @brief create layout for all new items with as many threads as the layout supports
 void ImportService::fillLayout(
     const std::shared_ptr<StateCache>& stateCache,
     const std::shared_ptr<GenericTask>& task)
 {
+    std::vector<std::shared_ptr<ContentState>> pending;
     for (auto&& [contPath, stateEntry] : stateCache->contentStateCache) {
         if (!stateEntry || stateEntry->getState() != ImportState::Created)
             continue;
-        stateCache->contentStateCache.at(contPath)->setObject(ImportState::Loaded, stateEntry->getObject());
-        fillSingleLayout(stateEntry, nullptr, stateEntry->getParentObject(), task);
+        stateEntry->setObject(ImportState::Loaded, stateEntry->getObject());
+        pending.push_back(stateEntry);
+    }
+    if (pending.empty())
+        return;
+    // containers of this scan were created or updated before, parents are loaded again once per scan
+    if (layout)
+        layout->clearCache();
+
+    // consecutive items of one container are handed to the layout together
+    auto batchSize = layout ? layout->getBatchSize() : 1;
+    std::vector<std::vector<std::shared_ptr<ContentState>>> batches;
+    int batchParent = INVALID_OBJECT_ID;
+    for (auto&& stateEntry : pending) {
+        auto&& object = stateEntry->getObject();
+        auto parentId = object ? object->getParentID() : INVALID_OBJECT_ID;
+        if (batches.empty() || batches.back().size() >= batchSize || parentId == INVALID_OBJECT_ID || parentId != batchParent)
+            batches.emplace_back();
+        batches.back().push_back(stateEntry);
+        batchParent = parentId;
     }
+
+    auto threadCount = layout ? layout->getConcurrency() : 1;
+    runJobs("LayoutWorker", threadCount, batches.size(), [this, &batches, &task](std::size_t index) {
+        auto&& batch = batches.at(index);
+        if (batch.size() > 1) {
+            fillBatchLayout(batch, task);
+        } else {
+            auto&& stateEntry = batch.front();
+            fillSingleLayout(stateEntry, nullptr, stateEntry->getParentObject(), task);
+        }
+    });
+    if (layout)
+        layout->clearCache();
 }
 
 /// @param object used to make code compatible with legacy scan
@@ -888,8 +1256,10 @@ void ImportService::fillSingleLayout(
                 log_warning("Playlist {} will not be parsed: Gerbera was compiled without JS support!", cdsObject->getLocation().c_str());
 #endif // HAVE_JS
             } else if (!autoscanDir || autoscanDir->hasContent(cdsObject->getClass())) {
-                // only lock mutex while processing item layout
-                LayoutAutoLock lock(layoutMutex);
+                // only lock mutex while processing item layout, concurrent layouts protect themselves
+                std::unique_lock<std::mutex> lock(layoutMutex, std::defer_lock);
+                if (layout->getConcurrency() <= 1)
+                    lock.lock();
                 // get ref'd objects with last mod time
                 auto refObjects = state ? database->getRefObjects(cdsObject->getID(), CdsEntryType::VirtualItem) : std::vector<int> {};
                 log_debug("Updating layout {}", cdsObject->getLocation().c_str());
@@ -907,12 +1277,42 @@ void ImportService::fillSingleLayout(
     }
 }
 
+void ImportService::fillBatchLayout(
+    const std::vector<std::shared_ptr<ContentState>>& batch,
+    const std::shared_ptr<GenericTask>& task)
+{
+    std::vector<Layout::LayoutItem> items;
+    items.reserve(batch.size());
+    for (auto&& stateEntry : batch) {
+        auto cdsObject = stateEntry->getObject();
+        if (!cdsObject || !cdsObject->isItem())
+            continue;
+        auto contentType = getValueOrDefault(mimetypeContenttypeMap, std::static_pointer_cast<CdsItem>(cdsObject)->getMimeType());
+        if (contentType == CONTENT_TYPE_PLAYLIST || (autoscanDir && !autoscanDir->hasContent(cdsObject->getClass()))) {
+            // playlists and ignored files are handled like single items
+            fillSingleLayout(stateEntry, nullptr, stateEntry->getParentObject(), task);
+            continue;
+        }
+        items.push_back({ cdsObject, stateEntry->getParentObject(), contentType, database->getRefObjects(cdsObject->getID(), CdsEntryType::VirtualItem) });
+    }
+    if (items.empty())
+        return;
+
+    // only lock mutex while processing item layout, concurrent layouts protect themselves
+    std::unique_lock<std::mutex> lock(layoutMutex, std::defer_lock);
+    if (layout->getConcurrency() <= 1)
+        lock.lock();
+    log_debug("Updating layout of {} items in {}", items.size(), items.front().object->getLocation().parent_path().c_str());
+    layout->processBatch(items, rootPath, containerTypeMap);
+}
+
 void ImportService::parseMetafile(
     const std::shared_ptr<CdsObject>& obj,
     const fs::path& path) const
 {
 #ifdef HAVE_JS
     try {
+        auto lock = std::scoped_lock(metafileMutex);
         if (metafileParserScript)
             metafileParserScript->processObject(obj, path);
     } catch (const std::runtime_error& e) {
@@ -1059,9 +1459,18 @@ void ImportService::assignFanArt(
     if (refObj && !fanart) {
         auto location = container->getLocation();
         if (refObj->isContainer() || (count < containerImageParentCount && container->getParentID() != CDS_ID_ROOT && std::distance(location.begin(), location.end()) > containerImageMinDepth)) {
-            auto refFanArt = refObj->getResource(ResourcePurpose::Thumbnail);
+            auto fanArtSource = refObj;
+            if (refObj->isItem() && refObj->getResourceCount() == 0 && refObj->getID() > CDS_ID_ROOT) {
+                // items taken from path index have no resources
+                try {
+                    fanArtSource = database->loadObject(refObj->getID());
+                } catch (const ObjectNotFoundException&) {
+                    log_debug("Object fanart {} removed {}", location.string(), refObj->getID());
+                }
+            }
+            auto refFanArt = fanArtSource->getResource(ResourcePurpose::Thumbnail);
             if (refFanArt) {
-                auto fanArtObj = refObj;
+                auto fanArtObj = fanArtSource;
                 auto fanArtObjId = refObj->getID();
                 auto fanArtResId = refFanArt->getResId();
                 if (refObj->getID() <= CDS_ID_ROOT) {
@@ -1130,6 +1539,24 @@ std::shared_ptr<CdsContainer> ImportService::createSingleContainer(
     return {};
 }
 
+/// @brief create container with the values Database::addContainer stored for the new virtual container
+static std::shared_ptr<CdsContainer> createStoredContainer(const std::shared_ptr<CdsContainer>& cont, int id, std::string location)
+{
+    reduceString(location, VIRTUAL_CONTAINER_SEPARATOR);
+    auto result = std::make_shared<CdsContainer>(CdsEntryType::VirtualContainer);
+    result->setID(id);
+    result->setParentID(cont->getParentID());
+    result->setTitle(cont->getTitle());
+    result->setClass(!cont->getClass().empty() ? cont->getClass() : UPNP_CLASS_CONTAINER);
+    result->setFlags(cont->getFlags());
+    result->setSource(cont->getSource());
+    result->setMetaData(cont->getMetaData());
+    result->setResources(cont->getResources());
+    result->setVirtual(true);
+    result->setLocation(location, CdsEntryType::VirtualContainer);
+    return result;
+}
+
 /// @param createdIds used by messaging in ContentManager
 std::pair<int, bool> ImportService::addContainerTree(
     int parentContainerId,
@@ -1138,6 +1565,7 @@ std::pair<int, bool> ImportService::addContainerTree(
     std::vector<int>& createdIds)
 {
     log_debug("start '{}' {}", rootPath.string(), parentContainerId);
+    auto treeLock = std::scoped_lock(containerTreeMutex);
     std::string tree; // accumulate path to container here
     int result = parentContainerId;
     bool isNew = false;
@@ -1153,9 +1581,8 @@ std::pair<int, bool> ImportService::addContainerTree(
         tree = fmt::format("{}{}{}", tree, VIRTUAL_CONTAINER_SEPARATOR, escape(item->getTitle(), VIRTUAL_CONTAINER_ESCAPE, VIRTUAL_CONTAINER_SEPARATOR));
         log_debug("Received container chain item {}", tree);
         if (isVirtual) {
-            for (auto&& [key, val] : configLayoutMapping) {
-                tree = std::regex_replace(tree, std::regex(key), val);
-            }
+            if (!layoutMapping.empty())
+                tree = layoutMapping.apply(std::move(tree));
             auto dirKeyValues = std::vector<std::string>();
             for (auto&& vdirSetting : virtualDirKeys) {
                 std::string field;
@@ -1214,10 +1641,14 @@ std::pair<int, bool> ImportService::addContainerTree(
                 auto cont = std::dynamic_pointer_cast<CdsContainer>(item);
                 cont->setVirtual(isVirtual);
                 log_debug("Creating container chain item {} virtual {}", subTree, cont->isVirtual());
+                std::shared_ptr<CdsContainer> container;
                 if (database->addContainer(result, subTree, cont, &result)) {
                     createdIds.push_back(result);
+                    if (cont->isVirtual() && cont->getEntryType() == CdsEntryType::VirtualContainer && !cont->hasFlag(ObjectFlag::PlaylistReference))
+                        container = createStoredContainer(cont, result, subTree);
                 }
-                auto container = std::dynamic_pointer_cast<CdsContainer>(database->loadObject(result));
+                if (!container)
+                    container = std::dynamic_pointer_cast<CdsContainer>(database->loadObject(result));
                 containerCache.set(subTree, container);
                 if (item->getMTime() > container->getMTime()) {
                     createdIds.push_back(result); // ensure update
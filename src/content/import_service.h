@@ -26,10 +26,13 @@
 #ifndef __IMPORT_SERVICE_H__
 #define __IMPORT_SERVICE_H__
 
+#include "content/layout_mapping.h"
+#include "content/path_index.h"
 #include "util/grb_fs.h"
 
 #include <map>
 #include <mutex>
+#include <optional>
 #include <tuple>
 #include <unordered_set>
 
@@ -138,6 +141,12 @@ public:
     using CacheAutoLock = std::scoped_lock<decltype(cacheMutex)>;
 
     mutable std::map<fs::path, std::shared_ptr<ContentState>> contentStateCache;
+    /// @brief directories that were not changed since the last scan, their files were not read
+    std::vector<fs::path> unchangedDirs;
+    /// @brief directories that could not be read completely, their content is kept
+    std::vector<fs::path> brokenDirs;
+    /// @brief modification times of the read directories, recorded when the import is finished
+    std::vector<std::pair<fs::path, fs::file_time_type>> dirModified;
 
     /// @brief store entry in cache map
     void cacheState(
@@ -216,7 +225,8 @@ private:
 
     std::map<std::string, std::string> mimetypeContenttypeMap;
     std::map<std::string, std::string> mimetypeUpnpclassMap;
-    std::map<std::string, std::string> configLayoutMapping;
+    /// @brief rewrite rules for virtual container paths
+    LayoutMapping layoutMapping;
     std::vector<UpnpMap> upnpMap;
 
     fs::path rootPath;
@@ -225,6 +235,8 @@ private:
     std::shared_ptr<StateCache> importStateCache;
     /// @brief cache for containers while creating new layout
     ContainerCache containerCache;
+    /// @brief database objects below the scanned location, loaded when a scan starts
+    PathIndex pathIndex;
 
     std::string noMediaName;
     bool hasReadableNames { false };
@@ -233,12 +245,22 @@ private:
     bool pcDirTypes { true };
     int containerImageParentCount { 2 };
     int containerImageMinDepth { 2 };
+    int metadataThreads { 1 };
+    int scanThreads { 1 };
+    std::size_t importBatchSize { 1 };
+    bool usePathIndex { true };
+    bool pruneUnchangedDirs { false };
 
     std::vector<std::vector<std::pair<std::string, std::string>>> virtualDirKeys;
 
     mutable std::mutex layoutMutex;
     using LayoutAutoLock = std::scoped_lock<decltype(layoutMutex)>;
     mutable std::shared_ptr<Layout> layout;
+    /// @brief virtual containers are looked up and created in one step when layouts run in parallel,
+    /// shared by all import services because autoscan directories can create the same containers
+    static inline std::mutex containerTreeMutex;
+    /// @brief metafile script keeps the current object and must not be entered by two extraction threads
+    mutable std::mutex metafileMutex;
 
 #ifdef HAVE_JS
     std::shared_ptr<PlaylistParserScript> playlistParserScript;
@@ -254,16 +276,53 @@ private:
     /// @brief build object titles based on location and upnpClass
     std::string makeTitle(const fs::path& objectPath, const std::string& upnpClass) const;
 
+    /// @brief folder waiting to be read by readTree
+    struct PendingDir;
     /// @brief read files from one folder depnending on settings
-    void readDir(const std::shared_ptr<StateCache>& stateCache, const fs::path& location, AutoScanSetting settings);
+    /// @param parentUnchanged parent folder was not changed since last scan so folder is still the same one
+    /// @param subDirs collects subfolders instead of reading them recursively
+    /// @param modified modification time of the folder if it was already read with the parent folder
+    void readDir(const std::shared_ptr<StateCache>& stateCache, const fs::path& location, AutoScanSetting settings, bool parentUnchanged = true, std::vector<PendingDir>* subDirs = nullptr, std::optional<fs::file_time_type> modified = std::nullopt);
+    /// @brief read all folders below location with up to scanThreads threads
+    void readTree(const std::shared_ptr<StateCache>& stateCache, const fs::path& location, const AutoScanSetting& settings);
+    /// @brief check whether the files of a folder were not changed since the last timed scan
+    bool isUnchangedDir(const fs::path& location, fs::file_time_type lastModified, const AutoScanSetting& settings) const;
     /// @brief read single file (triggered by autoscan)
     void readFile(const std::shared_ptr<StateCache>& stateCache, const fs::path& location);
     /// @brief create containers for all discovered folders
     void createContainers(const std::shared_ptr<StateCache>& stateCache, int parentContainerId, AutoScanSetting& settings);
+    /// @brief pending item creation or update of a single file
+    struct ItemJob {
+        fs::directory_entry dirEntry;
+        /// @brief object found in cache or database
+        std::shared_ptr<CdsObject> cdsObj;
+        /// @brief item with extracted metadata, empty if file is skipped
+        std::shared_ptr<CdsItem> item;
+        /// @brief extra objects referencing the item before update
+        std::unordered_set<int> refObjects;
+        bool isChanged { false };
+        bool skip { false };
+
+        /// @brief check whether metadata must be read from file
+        bool needsExtraction() const;
+    };
+
     /// @brief create items for all discovered files
     void createItems(const std::shared_ptr<StateCache>& stateCache, AutoScanSetting& settings);
+    /// @brief find existing objects and prepare changed items for update
+    std::map<fs::path, ItemJob> prepareItems(const std::shared_ptr<StateCache>& stateCache);
+    /// @brief read metadata for all pending jobs with up to metadataThreads threads
+    void extractItems(std::map<fs::path, ItemJob>& jobs);
+    /// @brief read metadata for a single job, may run on worker thread
+    void extractSingleItem(ItemJob& job);
+    /// @brief write pending new items to database and run post creation handlers
+    void flushNewItems(
+        const std::shared_ptr<StateCache>& stateCache,
+        std::vector<std::pair<std::shared_ptr<CdsItem>, fs::directory_entry>>& newItems);
     void updateSingleItem(const fs::directory_entry& dirEntry, const std::shared_ptr<CdsItem>& item, const std::string& mimetype);
     void fillLayout(const std::shared_ptr<StateCache>& stateCache, const std::shared_ptr<GenericTask>& task);
+    /// @brief create layout of items that share their parent container in one layout call, falls back to single items on error
+    void fillBatchLayout(const std::vector<std::shared_ptr<ContentState>>& batch, const std::shared_ptr<GenericTask>& task);
     void updateFanArt(const std::shared_ptr<StateCache>& stateCache, bool isDir);
     /// @brief try to assign fanart to container
     /// @param container target object
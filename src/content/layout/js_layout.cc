@@ -35,13 +35,81 @@
 #ifdef HAVE_JS
 #include "js_layout.h" // API
 
+#include "cds/cds_objects.h"
+#include "config/config.h"
+#include "config/config_val.h"
+#include "config/result/autoscan.h"
+#include "content/content.h"
 #include "content/scripting/import_script.h"
+#include "content/scripting/scripting_runtime.h"
+#include "context.h"
+
+/// @brief maximum number of objects of one directory passed to the batched js function
+static constexpr std::size_t LAYOUT_BATCH_SIZE = 100;
 
 JSLayout::JSLayout(const std::shared_ptr<Content>& content, const std::string& parent)
     : Layout(content)
-    , import_script(std::make_shared<ImportScript>(content, parent))
 {
-    import_script->init();
+    auto heapCount = content->getScriptingRuntime()->getHeapCount();
+    import_scripts.reserve(heapCount);
+    for (std::size_t heap = 0; heap < heapCount; heap++) {
+        auto script = std::make_shared<ImportScript>(content, parent, heap);
+        script->init();
+        import_scripts.push_back(std::move(script));
+    }
+    idle_scripts = import_scripts;
+
+    batchFunction = content->getContext()->getConfig()->getOption(ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_ITEMS);
+    if (!batchFunction.empty() && !import_scripts.empty() && !import_scripts.front()->hasFunction(batchFunction)) {
+        log_warning("javascript function {}() not found, importing single objects", batchFunction);
+        batchFunction.clear();
+    }
+}
+
+std::size_t JSLayout::getBatchSize() const
+{
+    return batchFunction.empty() ? 1 : LAYOUT_BATCH_SIZE;
+}
+
+void JSLayout::clearCache()
+{
+    for (auto&& script : import_scripts)
+        script->clearParentCache();
+}
+
+std::shared_ptr<ImportScript> JSLayout::acquireScript()
+{
+    std::unique_lock<std::mutex> lock(scriptMutex);
+    scriptCond.wait(lock, [this] { return !idle_scripts.empty(); });
+    auto script = std::move(idle_scripts.back());
+    idle_scripts.pop_back();
+    return script;
+}
+
+void JSLayout::releaseScript(const std::shared_ptr<ImportScript>& script)
+{
+    {
+        std::scoped_lock<std::mutex> lock(scriptMutex);
+        idle_scripts.push_back(script);
+    }
+    scriptCond.notify_one();
+}
+
+template <class Func>
+auto JSLayout::withScript(Func func)
+{
+    if (import_scripts.empty())
+        return decltype(func(import_scripts.front())) {};
+
+    auto script = acquireScript();
+    try {
+        auto result = func(script);
+        releaseScript(script);
+        return result;
+    } catch (...) {
+        releaseScript(script);
+        throw;
+    }
 }
 
 std::vector<int> JSLayout::addAudio(
@@ -50,10 +118,7 @@ std::vector<int> JSLayout::addAudio(
     const fs::path& rootpath,
     const std::map<AutoscanMediaMode, std::string>& containerMap)
 {
-    if (!import_script)
-        return {};
-
-    return import_script->addAudio(obj, parent, rootpath, containerMap);
+    return withScript([&](auto&& script) { return script->addAudio(obj, parent, rootpath, containerMap); });
 }
 
 std::vector<int> JSLayout::addVideo(
@@ -62,10 +127,7 @@ std::vector<int> JSLayout::addVideo(
     const fs::path& rootpath,
     const std::map<AutoscanMediaMode, std::string>& containerMap)
 {
-    if (!import_script)
-        return {};
-
-    return import_script->addVideo(obj, parent, rootpath, containerMap);
+    return withScript([&](auto&& script) { return script->addVideo(obj, parent, rootpath, containerMap); });
 }
 
 std::vector<int> JSLayout::addImage(
@@ -74,10 +136,49 @@ std::vector<int> JSLayout::addImage(
     const fs::path& rootpath,
     const std::map<AutoscanMediaMode, std::string>& containerMap)
 {
-    if (!import_script)
-        return {};
+    return withScript([&](auto&& script) { return script->addImage(obj, parent, rootpath, containerMap); });
+}
 
-    return import_script->addImage(obj, parent, rootpath, containerMap);
+void JSLayout::processCdsObjects(
+    std::vector<LayoutItem>& items,
+    const fs::path& rootpath,
+    const std::map<AutoscanMediaMode, std::string>& containerMap)
+{
+    if (batchFunction.empty() || items.size() < 2) {
+        Layout::processCdsObjects(items, rootpath, containerMap);
+        return;
+    }
+
+    std::vector<ImportScript::LayoutItem> batch;
+    std::vector<LayoutItem*> batchItems;
+    for (auto&& item : items) {
+        AutoscanMediaMode mediaMode;
+        switch (item.object->getMediaType(item.contentType)) {
+        case ObjectType::Audio:
+            mediaMode = AutoscanMediaMode::Audio;
+            break;
+        case ObjectType::Image:
+            mediaMode = AutoscanMediaMode::Image;
+            break;
+        case ObjectType::Video:
+            mediaMode = AutoscanMediaMode::Video;
+            break;
+        default:
+            // online items, playlists and unknown types keep their single object handling
+            processCdsObject(item.object, item.parent, rootpath, item.contentType, containerMap, item.refObjects);
+            continue;
+        }
+        log_debug("Process CDS Object: {}", item.object->getTitle());
+        batch.push_back({ createVirtualObject(item.object), item.parent, mediaMode });
+        batchItems.push_back(&item);
+    }
+    if (batch.empty())
+        return;
+
+    auto results = withScript([&](auto&& script) { return script->addItems(batch, batchFunction, rootpath, containerMap); });
+    for (std::size_t index = 0; index < batchItems.size() && index < results.size(); index++) {
+        cleanUp(batchItems.at(index)->refObjects, results.at(index));
+    }
 }
 
 #ifdef ONLINE_SERVICES
@@ -87,10 +188,7 @@ std::vector<int> JSLayout::addOnlineItem(
     const fs::path& rootpath,
     const std::map<AutoscanMediaMode, std::string>& containerMap)
 {
-    if (!import_script)
-        return {};
-
-    return import_script->addOnlineItem(obj, rootpath, containerMap);
+    return withScript([&](auto&& script) { return script->addOnlineItem(obj, rootpath, containerMap); });
 }
 #endif
 #endif // HAVE_JS
@@ -36,19 +36,43 @@
 
 #include "layout.h"
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 class ImportScript;
-class ScriptingRuntime;
 
 /// @brief layout class implementation for flexible java script implemented virtual layout
 class JSLayout : public Layout {
 public:
     JSLayout(const std::shared_ptr<Content>& content, const std::string& parent);
 
+    std::size_t getConcurrency() const override { return import_scripts.size(); }
+    std::size_t getBatchSize() const override;
+    void clearCache() override;
+
+    void processCdsObjects(
+        std::vector<LayoutItem>& items,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override;
+
 protected:
-    std::shared_ptr<ScriptingRuntime> runtime;
-    std::shared_ptr<ImportScript> import_script;
+    /// @brief one import script per heap of the scripting runtime
+    std::vector<std::shared_ptr<ImportScript>> import_scripts;
+    /// @brief import scripts that are not used by a thread
+    std::vector<std::shared_ptr<ImportScript>> idle_scripts;
+    std::mutex scriptMutex;
+    std::condition_variable scriptCond;
+    /// @brief js function for batches of objects, empty if scripts only handle single objects
+    std::string batchFunction;
+
+    /// @brief hand out idle import script to calling thread, wait if all are busy
+    std::shared_ptr<ImportScript> acquireScript();
+    /// @brief return import script to pool
+    void releaseScript(const std::shared_ptr<ImportScript>& script);
+    /// @brief run layout function with script of the pool
+    template <class Func>
+    auto withScript(Func func);
 
     std::vector<int> addVideo(
         const std::shared_ptr<CdsObject>& obj,
@@ -45,10 +45,7 @@ void Layout::processCdsObject(const std::shared_ptr<CdsObject>& obj,
     std::vector<int>& refObjects)
 {
     log_debug("Process CDS Object: {}", obj->getTitle());
-    auto clone = CdsObject::createObject(obj->getObjectType());
-    obj->copyTo(clone);
-    clone->setEntryType(obj->isItem() ? CdsEntryType::VirtualItem : CdsEntryType::VirtualContainer);
-    clone->setVirtual(true);
+    auto clone = createVirtualObject(obj);
 
     std::vector<int> resObjects;
     switch (obj->getMediaType(contentType)) {
@@ -77,6 +74,48 @@ void Layout::processCdsObject(const std::shared_ptr<CdsObject>& obj,
     cleanUp(refObjects, resObjects);
 }
 
+void Layout::processCdsObjects(
+    std::vector<LayoutItem>& items,
+    const fs::path& rootpath,
+    const std::map<AutoscanMediaMode, std::string>& containerMap)
+{
+    for (auto&& item : items) {
+        processCdsObject(item.object, item.parent, rootpath, item.contentType, containerMap, item.refObjects);
+    }
+}
+
+void Layout::processBatch(
+    std::vector<LayoutItem>& items,
+    const fs::path& rootpath,
+    const std::map<AutoscanMediaMode, std::string>& containerMap)
+{
+    try {
+        processCdsObjects(items, rootpath, containerMap);
+        return;
+    } catch (const std::runtime_error& ex) {
+        log_error("{}", ex.what());
+    }
+
+    // one failing item must not drop the layout of the whole batch, retry each item on its own
+    log_warning("Batch layout of {} items failed, processing them one by one", items.size());
+    for (auto&& item : items) {
+        try {
+            processCdsObject(item.object, item.parent, rootpath, item.contentType, containerMap, item.refObjects);
+        } catch (const std::runtime_error& ex) {
+            log_error("{}", ex.what());
+        }
+    }
+}
+
+std::shared_ptr<CdsObject> Layout::createVirtualObject(const std::shared_ptr<CdsObject>& obj)
+{
+    auto clone = CdsObject::createObject(obj->getObjectType());
+    obj->copyTo(clone);
+    clone->setEntryType(obj->isItem() ? CdsEntryType::VirtualItem : CdsEntryType::VirtualContainer);
+    clone->setVirtual(true);
+    return clone;
+}
+
 void Layout::cleanUp(const std::vector<int>& refObjects, const std::vector<int>& resObjects)
 {
     // compare ref'd objects
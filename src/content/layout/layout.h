@@ -37,6 +37,8 @@
 #include "util/grb_fs.h"
 
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 // forward declaration
@@ -68,6 +70,32 @@ public:
         const std::map<AutoscanMediaMode, std::string>& containerMap,
         std::vector<int>& refObjects);
 
+    /// @brief object with its import parameters for batched layout
+    struct LayoutItem {
+        std::shared_ptr<CdsObject> object;
+        std::shared_ptr<CdsContainer> parent;
+        std::string contentType;
+        std::vector<int> refObjects;
+    };
+
+    /// @brief create virtual layout for objects of one container
+    virtual void processCdsObjects(
+        std::vector<LayoutItem>& items,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap);
+    /// @brief create virtual layout for objects of one container, one by one if that fails
+    void processBatch(
+        std::vector<LayoutItem>& items,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap);
+
+    /// @brief number of objects that can be processed in parallel
+    virtual std::size_t getConcurrency() const { return 1; }
+    /// @brief maximum number of objects passed to processCdsObjects at once
+    virtual std::size_t getBatchSize() const { return 1; }
+    /// @brief forget objects loaded during the current import
+    virtual void clearCache() { }
+
 protected:
     /// @brief create virtual video layout
     virtual std::vector<int> addVideo(
@@ -102,6 +130,8 @@ protected:
 
     std::shared_ptr<Content> content;
 
+    /// @brief create virtual copy of object that is handed to the layout functions
+    static std::shared_ptr<CdsObject> createVirtualObject(const std::shared_ptr<CdsObject>& obj);
     void cleanUp(const std::vector<int>& refObjects, const std::vector<int>& resObjects);
 };
 
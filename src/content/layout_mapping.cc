@@ -0,0 +1,67 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    layout_mapping.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/layout_mapping.cc
+#define GRB_LOG_FAC GrbLogFacility::content
+
+#include "layout_mapping.h" // API
+
+#include "util/logger.h"
+
+LayoutMapping::LayoutMapping(const std::map<std::string, std::string>& mapping)
+{
+    rules.reserve(mapping.size());
+    for (auto&& [key, replacement] : mapping) {
+        if (isLiteral(key, replacement)) {
+            rules.push_back({ key, replacement, true, {} });
+            continue;
+        }
+        try {
+            rules.push_back({ key, replacement, false, std::regex(key) });
+        } catch (const std::regex_error& e) {
+            log_error("Invalid layout mapping '{}': {}", key, e.what());
+        }
+    }
+}
+
+bool LayoutMapping::isLiteral(const std::string& key, const std::string& replacement)
+{
+    // empty key matches between all characters and $ refers to matches in the replacement
+    return !key.empty() && key.find_first_of("\\^$.|?*+()[]{}") == std::string::npos && replacement.find('$') == std::string::npos;
+}
+
+std::string LayoutMapping::apply(std::string path) const
+{
+    for (auto&& rule : rules) {
+        if (!rule.literal) {
+            path = std::regex_replace(path, rule.pattern, rule.replacement);
+            continue;
+        }
+        auto pos = path.find(rule.key);
+        while (pos != std::string::npos) {
+            path.replace(pos, rule.key.size(), rule.replacement);
+            pos = path.find(rule.key, pos + rule.replacement.size());
+        }
+    }
+    return path;
+}
@@ -0,0 +1,60 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    layout_mapping.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/layout_mapping.h
+/// @brief Definition of the LayoutMapping class.
+
+#ifndef __CONTENT_LAYOUT_MAPPING_H__
+#define __CONTENT_LAYOUT_MAPPING_H__
+
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+/// @brief Rewrite rules for virtual container paths from import/layout/path
+///
+/// Rules are compiled once and applied in the order of the configuration.
+/// Keys without regular expression syntax are replaced by plain string search.
+class LayoutMapping {
+public:
+    explicit LayoutMapping(const std::map<std::string, std::string>& mapping);
+
+    /// @brief apply all rules to path, each rule sees the result of the previous one
+    std::string apply(std::string path) const;
+    bool empty() const { return rules.empty(); }
+
+    /// @brief check whether key can be matched without regular expression
+    static bool isLiteral(const std::string& key, const std::string& replacement);
+
+private:
+    struct Rule {
+        std::string key;
+        std::string replacement;
+        bool literal;
+        std::regex pattern;
+    };
+    std::vector<Rule> rules;
+};
+
+#endif // __CONTENT_LAYOUT_MAPPING_H__
@@ -0,0 +1,127 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    path_index.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/path_index.cc
+#define GRB_LOG_FAC GrbLogFacility::content
+
+#include "path_index.h" // API
+
+#include "cds/cds_objects.h"
+#include "util/logger.h"
+#include "util/tools.h"
+
+void PathIndex::load(const std::shared_ptr<Database>& database, const fs::path& root)
+{
+    auto pathEntries = database->getPathEntries(root);
+    AutoLock lock(mutex);
+    entries.clear();
+    entries.reserve(pathEntries.size());
+    for (auto&& [path, entry] : pathEntries)
+        insert(path.string(), std::move(entry));
+    this->root = root;
+    loaded = true;
+    log_debug("Loaded {} path(s) below {}", entries.size(), root.string());
+}
+
+void PathIndex::clear()
+{
+    AutoLock lock(mutex);
+    entries.clear();
+    root.clear();
+    loaded = false;
+}
+
+bool PathIndex::covers(const fs::path& path) const
+{
+    AutoLock lock(mutex);
+    if (!loaded)
+        return false;
+    auto rootString = root.string();
+    auto pathString = path.string();
+    if (pathString == rootString || rootString == "/")
+        return true;
+    return pathString.size() > rootString.size() && startswith(pathString, rootString) && pathString.at(rootString.size()) == DIR_SEPARATOR;
+}
+
+std::optional<DbPathEntry> PathIndex::find(const fs::path& path) const
+{
+    AutoLock lock(mutex);
+    auto entry = entries.find(path.string());
+    if (entry == entries.end())
+        return {};
+    return entry->second;
+}
+
+void PathIndex::add(const std::shared_ptr<CdsObject>& object)
+{
+    AutoLock lock(mutex);
+    if (!loaded)
+        return;
+    insert(object->getLocation().string(),
+        DbPathEntry {
+            object->getID(),
+            object->getParentID(),
+            object->getRefID(),
+            object->getObjectType(),
+            object->getEntryType(),
+            object->getClass(),
+            object->getMTime(),
+        });
+}
+
+void PathIndex::remove(const fs::path& path)
+{
+    AutoLock lock(mutex);
+    entries.erase(path.string());
+}
+
+std::size_t PathIndex::size() const
+{
+    AutoLock lock(mutex);
+    return entries.size();
+}
+
+void PathIndex::insert(const std::string& path, DbPathEntry entry)
+{
+    auto existing = entries.find(path);
+    if (existing == entries.end()) {
+        entries.emplace(path, std::move(entry));
+        return;
+    }
+    // keep object without reference
+    if (existing->second.refId <= CDS_ID_ROOT && entry.refId > CDS_ID_ROOT)
+        return;
+    existing->second = std::move(entry);
+}
+
+std::shared_ptr<CdsObject> PathIndex::createObject(const fs::path& path, const DbPathEntry& entry)
+{
+    auto object = CdsObject::createObject(entry.objectType);
+    object->setID(entry.id);
+    object->setParentID(entry.parentId);
+    object->setRefID(entry.refId);
+    object->setClass(entry.upnpClass);
+    object->setMTime(entry.mtime);
+    object->setLocation(path, entry.entryType);
+    return object;
+}
@@ -0,0 +1,75 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    path_index.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/path_index.h
+/// @brief Definition of the PathIndex class.
+
+#ifndef __CONTENT_PATH_INDEX_H__
+#define __CONTENT_PATH_INDEX_H__
+
+#include "database/database.h"
+#include "util/grb_fs.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+class CdsObject;
+
+/// @brief Files and directories of the database below an import root
+///
+/// The index is loaded with one query when a scan starts, so the scan does not need to look up each file.
+/// Objects written during the scan have to be added. Paths below the root that are not in the index are not in the database.
+class PathIndex {
+public:
+    /// @brief replace content by the objects at root and below
+    void load(const std::shared_ptr<Database>& database, const fs::path& root);
+    void clear();
+
+    /// @brief check whether the index is loaded for path
+    bool covers(const fs::path& path) const;
+    /// @brief get entry of path, objects without reference are preferred like in Database::findObjectByPath
+    std::optional<DbPathEntry> find(const fs::path& path) const;
+    /// @brief add or replace entry after object was written to the database
+    void add(const std::shared_ptr<CdsObject>& object);
+    void remove(const fs::path& path);
+    std::size_t size() const;
+
+    /// @brief create object with the values of the entry, it has no metadata and resources
+    static std::shared_ptr<CdsObject> createObject(const fs::path& path, const DbPathEntry& entry);
+
+private:
+    /// @brief add entry unless it would replace an object without reference, lock must be held
+    void insert(const std::string& path, DbPathEntry entry);
+
+    fs::path root;
+    bool loaded { false };
+    std::unordered_map<std::string, DbPathEntry> entries;
+
+    mutable std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+};
+
+#endif // __CONTENT_PATH_INDEX_H__
@@ -184,7 +184,7 @@ std::vector<int> CuesheetParserScript::processObject(
     currentLine = new char[ONE_TEXTLINE_BYTES];
     currentLine[0] = '\0';
 
-    ScriptingRuntime::AutoLock lock(runtime->getMutex());
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
     std::vector<int> result;
 
     try {
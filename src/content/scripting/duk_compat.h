@@ -32,4 +32,8 @@
 #define duk_safe_to_stacktrace duk_safe_to_string
 #endif
 
+#ifndef DUK_HIDDEN_SYMBOL
+#define DUK_HIDDEN_SYMBOL(x) ("\xFF" x)
+#endif
+
 #endif // __GRB_DUK_COMPAT_H__
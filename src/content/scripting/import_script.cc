@@ -40,14 +40,43 @@
 #include "config/result/autoscan.h"
 #include "content/content.h"
 #include "context.h"
+#include "scripting_runtime.h"
 #include "util/string_converter.h"
 #include "util/tools.h"
 
-ImportScript::ImportScript(const std::shared_ptr<Content>& content, const std::string& parent)
-    : Script(content, parent, "import", "orig", true, content->getContext()->getConverterManager()->i2i())
+ImportScript::ImportScript(const std::shared_ptr<Content>& content, const std::string& parent, std::size_t heap)
+    : Script(content, parent, "import", "orig", true, content->getContext()->getConverterManager()->i2i(), heap)
 {
 }
 
+/// @brief upnp class of containers configured for media mode
+static std::string getContainerType(
+    const std::shared_ptr<AutoscanDirectory>& autoScan,
+    const fs::path& scriptPath,
+    AutoscanMediaMode mediaMode,
+    const std::map<AutoscanMediaMode, std::string>& containerMap)
+{
+    if (autoScan && !scriptPath.empty() && containerMap.find(mediaMode) != containerMap.end())
+        return getValueOrDefault(containerMap, mediaMode, containerMap.at(mediaMode));
+    return AutoscanDirectory::ContainerTypesDefaults.at(mediaMode);
+}
+
+/// @brief name of media mode passed to batched layout function
+static std::string getMediaTypeName(AutoscanMediaMode mediaMode)
+{
+    switch (mediaMode) {
+    case AutoscanMediaMode::Audio:
+        return "audio";
+    case AutoscanMediaMode::Image:
+        return "image";
+    case AutoscanMediaMode::Video:
+        return "video";
+    case AutoscanMediaMode::Mixed:
+        break;
+    }
+    return "mixed";
+}
+
 std::vector<int> ImportScript::callFunction(
     const std::shared_ptr<CdsObject>& obj,
     const std::shared_ptr<CdsContainer>& cont,
@@ -57,19 +86,15 @@ std::vector<int> ImportScript::callFunction(
     const std::map<AutoscanMediaMode,
         std::string>& containerMap)
 {
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
     std::vector<int> result;
     processed = obj;
     try {
         auto autoScan = content->getAutoscanDirectory(scriptPath);
-        std::string containerType;
-        if (autoScan && !scriptPath.empty() && containerMap.find(mediaMode) != containerMap.end()) {
-            containerType = getValueOrDefault(containerMap, mediaMode, containerMap.at(mediaMode));
-        } else {
-            containerType = AutoscanDirectory::ContainerTypesDefaults.at(mediaMode);
-        }
+        auto containerType = getContainerType(autoScan, scriptPath, mediaMode, containerMap);
 
         log_debug("{}, path = {}, containerType = {}", function, scriptPath.c_str(), containerType);
-        result = call(obj, cont, function, scriptPath, containerType);
+        result = call(obj, cont, function, scriptPath, containerType, autoScan);
     } catch (const std::runtime_error&) {
         processed = nullptr;
         throw;
@@ -85,6 +110,41 @@ std::vector<int> ImportScript::callFunction(
     return result;
 }
 
+std::vector<std::vector<int>> ImportScript::addItems(
+    const std::vector<LayoutItem>& items,
+    const std::string& function,
+    const fs::path& scriptPath,
+    const std::map<AutoscanMediaMode, std::string>& containerMap)
+{
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+    std::vector<std::vector<int>> result;
+    try {
+        auto autoScan = content->getAutoscanDirectory(scriptPath);
+        std::vector<CallItem> callItemList;
+        callItemList.reserve(items.size());
+        processedItems.reserve(items.size());
+        for (auto&& item : items) {
+            callItemList.push_back({ item.object, item.container, getContainerType(autoScan, scriptPath, item.mediaMode, containerMap), getMediaTypeName(item.mediaMode) });
+            processedItems.push_back(item.object);
+        }
+
+        log_debug("{}, path = {}, items = {}", function, scriptPath.c_str(), items.size());
+        result = callItems(callItemList, function, scriptPath, autoScan);
+    } catch (const std::runtime_error&) {
+        processedItems.clear();
+        throw;
+    }
+
+    processedItems.clear();
+
+    gc_counter += static_cast<int>(items.size());
+    if (gc_counter > JS_CALL_GC_AFTER_NUM) {
+        duk_gc(ctx, 0);
+        gc_counter = 0;
+    }
+    return result;
+}
+
 std::vector<int> ImportScript::addAudio(const std::shared_ptr<CdsObject>& obj, const std::shared_ptr<CdsContainer>& cont, const fs::path& scriptPath, const std::map<AutoscanMediaMode, std::string>& containerMap)
 {
     return callFunction(obj, cont, config->getOption(ConfigVal::IMPORT_SCRIPTING_IMPORT_FUNCTION_AUDIOFILE), scriptPath, AutoscanMediaMode::Audio, containerMap);
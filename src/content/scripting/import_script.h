@@ -48,7 +48,7 @@ class ScriptingRuntime;
 
 class ImportScript : public Script {
 public:
-    ImportScript(const std::shared_ptr<Content>& content, const std::string& parent);
+    ImportScript(const std::shared_ptr<Content>& content, const std::string& parent, std::size_t heap = 0);
 
     std::vector<int> addVideo(const std::shared_ptr<CdsObject>& obj,
         const std::shared_ptr<CdsContainer>& cont,
@@ -62,6 +62,18 @@ public:
         const std::shared_ptr<CdsContainer>& cont,
         const fs::path& scriptPath,
         const std::map<AutoscanMediaMode, std::string>& containerMap);
+
+    /// @brief object for batched layout function
+    struct LayoutItem {
+        std::shared_ptr<CdsObject> object;
+        std::shared_ptr<CdsContainer> container;
+        AutoscanMediaMode mediaMode;
+    };
+    /// @brief call batched layout function for objects of one directory, returns created ids per object
+    std::vector<std::vector<int>> addItems(const std::vector<LayoutItem>& items,
+        const std::string& function,
+        const fs::path& scriptPath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap);
 #ifdef ONLINE_SERVICES
     std::vector<int> addOnlineItem(const std::shared_ptr<CdsObject>& obj,
         const fs::path& scriptPath,
@@ -165,7 +165,7 @@ duk_ret_t js_addCdsObject(duk_context* ctx)
     const char* containerId = duk_to_string(ctx, 1);
     if (!containerId)
         containerId = "-1";
-    // stack: js_cds_obj containerId rootPath
+    // stack: js_cds_obj containerId rootPath item
 
     try {
         std::string rootPath = duk_to_string(ctx, 2);
@@ -174,21 +174,40 @@ duk_ret_t js_addCdsObject(duk_context* ctx)
             duk_push_undefined(ctx);
         else
             duk_get_global_string(ctx, self->getOrigName().c_str());
-        // stack: js_cds_obj containerId rootPath js_orig_obj
+        // stack: js_cds_obj containerId rootPath item js_orig_obj
 
         if (duk_is_undefined(ctx, -1)) {
             log_debug("Could not retrieve global {} object", self->getOrigName());
             return 0;
         }
 
-        auto origObject = self->dukObject2cdsObject(self->getProcessedObject());
+        auto processed = self->getProcessedObject();
+        if (duk_is_array(ctx, -1)) {
+            // batch call: the original is the item passed as fourth argument or the item with the id of the passed object
+            auto index = Script::getBatchIndex(ctx, 3);
+            if (!index) {
+                duk_get_prop_string(ctx, 0, "id");
+                index = self->getProcessedIndex(duk_to_int(ctx, -1));
+                duk_pop(ctx);
+            }
+            if (!index || index.value() >= duk_get_length(ctx, -1)) {
+                log_warning("addCdsObject: object does not belong to an item of batch {}, pass the item as fourth argument", self->getOrigName());
+                return 0;
+            }
+            duk_get_prop_index(ctx, -1, static_cast<duk_uarridx_t>(index.value()));
+            duk_remove(ctx, -2);
+            processed = self->getProcessedObject(index.value());
+        }
+        // stack: js_cds_obj containerId rootPath item js_orig_obj
+
+        auto origObject = self->dukObject2cdsObject(processed);
         if (!origObject) {
             log_debug("No orig object");
             return 0;
         }
 
         duk_swap_top(ctx, 0);
-        // stack: js_orig_obj containerId rootPath js_cds_obj
+        // stack: js_orig_obj containerId rootPath item js_cds_obj
         auto [cdsObj, pcdId] = self->createObject2cdsObject(origObject, rootPath);
         if (!cdsObj) {
             log_debug("No content object");
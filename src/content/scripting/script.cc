@@ -52,6 +52,7 @@
 #include "database/database.h"
 #include "duk_compat.h"
 #include "js_functions.h"
+#include "script_bytecode_cache.h"
 #include "script_names.h"
 #include "script_property.h"
 #include "scripting_runtime.h"
@@ -62,13 +63,14 @@
 #include "content/onlineservice/online_service.h"
 #endif
 
+#include <algorithm>
 #include <array>
 #include <fmt/chrono.h>
 
 static constexpr std::array jsGlobalFunctions {
     duk_function_list_entry { "print2", js_print2, DUK_VARARGS },
     duk_function_list_entry { "print", js_print, DUK_VARARGS },
-    duk_function_list_entry { "addCdsObject", js_addCdsObject, 3 },
+    duk_function_list_entry { "addCdsObject", js_addCdsObject, 4 },
     duk_function_list_entry { "addContainerTree", js_addContainerTree, DUK_VARARGS },
     duk_function_list_entry { "copyObject", js_copyObject, 1 },
     duk_function_list_entry { "f2i", js_f2i, 1 },
@@ -114,7 +116,8 @@ Script::Script(
     const std::string& name,
     std::string objName,
     bool needResult,
-    std::shared_ptr<StringConverter> sc)
+    std::shared_ptr<StringConverter> sc,
+    std::size_t heap)
     : config(content->getContext()->getConfig())
     , database(content->getContext()->getDatabase())
     , converterManager(content->getContext()->getConverterManager())
@@ -123,14 +126,15 @@ Script::Script(
     , runtime(content->getScriptingRuntime())
     , sc(std::move(sc))
     , contextName(fmt::format("{}_{}", name, parent))
+    , heap(heap)
     , objectName(std::move(objName))
 {
     hasCaseSensitiveNames = config->getBoolOption(ConfigVal::IMPORT_CASE_SENSITIVE_TAGS);
     entrySeparator = config->getOption(ConfigVal::IMPORT_LIBOPTS_ENTRY_SEP);
     /* create a context and associate it with the JS run time */
-    ScriptingRuntime::AutoLock lock(runtime->getMutex());
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
     replaceAllString(contextName, "/", "_");
-    ctx = runtime->createContext(contextName);
+    ctx = runtime->createContext(contextName, heap);
     if (!ctx)
         throw_std_runtime_error("Scripting: could not initialize js context");
 
@@ -143,6 +147,7 @@ Script::Script(
 
 void Script::init()
 {
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
     duk_push_thread_stash(ctx, ctx);
     duk_push_pointer(ctx, this);
     duk_put_prop_string(ctx, -2, "this");
@@ -357,7 +362,8 @@ void Script::loadContent()
 
 Script::~Script()
 {
-    runtime->destroyContext(contextName);
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+    runtime->destroyContext(contextName, heap);
 }
 
 Script* Script::getContextScript(duk_context* ctx)
@@ -392,12 +398,45 @@ void Script::defineFunctions(const duk_function_list_entry* functions)
 
 void Script::_load(const fs::path& scriptPath)
 {
-    std::string scriptText = GrbFile(scriptPath).readTextFile();
     this->scriptPath = scriptPath;
+    if (loadFunction(ctx, runtime->getBytecodeCache(), scriptPath, converterManager->j2i()))
+        log_debug("Loaded {} from bytecode cache", scriptPath.c_str());
+}
+
+/// @brief push function from cached bytecode, nothing is pushed if that fails
+static bool loadBytecode(duk_context* ctx, const fs::path& scriptPath, const std::optional<std::vector<std::byte>>& bytecode)
+{
+    if (!bytecode)
+        return false;
+
+    auto buffer = duk_push_fixed_buffer(ctx, bytecode->size());
+    std::copy(bytecode->begin(), bytecode->end(), static_cast<std::byte*>(buffer));
+    auto loadFunction = [](duk_context* ctx, void*) -> duk_ret_t {
+        duk_load_function(ctx);
+        return 1;
+    };
+    if (duk_safe_call(ctx, loadFunction, nullptr, 1, 1) != DUK_EXEC_SUCCESS) {
+        log_warning("Failed to load cached script {}: {}", scriptPath.c_str(), duk_safe_to_string(ctx, -1));
+        duk_pop(ctx);
+        return false;
+    }
+    return true;
+}
+
+bool Script::loadFunction(
+    duk_context* ctx,
+    const std::shared_ptr<ScriptBytecodeCache>& bytecodeCache,
+    const fs::path& scriptPath,
+    const std::shared_ptr<StringConverter>& j2i)
+{
+    if (bytecodeCache && loadBytecode(ctx, scriptPath, bytecodeCache->get(scriptPath)))
+        return true;
+
+    std::string scriptText = GrbFile(scriptPath).readTextFile();
     if (scriptText.empty())
         throw_std_runtime_error("empty script");
+    auto sourceText = bytecodeCache ? scriptText : std::string();
 
-    auto j2i = converterManager->j2i();
     try {
         auto [mval, err] = j2i->convert(scriptText, true);
         if (!err.empty()) {
@@ -413,6 +452,16 @@ void Script::_load(const fs::path& scriptPath)
         log_error("Failed to load script {}: {}", scriptPath.c_str(), duk_safe_to_stacktrace(ctx, -1));
         throw_std_runtime_error("Scripting: failed to compile {}", scriptPath.c_str());
     }
+
+    if (bytecodeCache) {
+        duk_dup_top(ctx);
+        duk_dump_function(ctx);
+        duk_size_t size = 0;
+        auto data = static_cast<const std::byte*>(duk_get_buffer(ctx, -1, &size));
+        bytecodeCache->set(scriptPath, sourceText, std::vector<std::byte>(data, data + size));
+        duk_pop(ctx);
+    }
+    return false;
 }
 
 void Script::_execute()
@@ -452,6 +501,81 @@ void Script::loadFolder(const fs::path& scriptFolder)
     }
 }
 
+/// @brief hidden property of batch items with their position in the batch
+static constexpr auto BATCH_INDEX = DUK_HIDDEN_SYMBOL("batchIndex");
+
+void Script::putBatchIndex(duk_context* ctx, duk_idx_t itemIdx, std::size_t index)
+{
+    itemIdx = duk_normalize_index(ctx, itemIdx);
+    duk_push_uint(ctx, static_cast<duk_uint_t>(index));
+    duk_put_prop_string(ctx, itemIdx, BATCH_INDEX);
+}
+
+std::optional<std::size_t> Script::getBatchIndex(duk_context* ctx, duk_idx_t idx)
+{
+    if (duk_is_number(ctx, idx)) {
+        auto index = duk_get_int(ctx, idx);
+        return index >= 0 ? std::optional<std::size_t>(index) : std::nullopt;
+    }
+    std::optional<std::size_t> result;
+    if (duk_is_object(ctx, idx)) {
+        if (duk_get_prop_string(ctx, idx, BATCH_INDEX))
+            result = duk_get_uint(ctx, -1);
+        duk_pop(ctx);
+    }
+    return result;
+}
+
+/// @brief push a copy of the plain js object at idx, so two slots do not share one object
+static void dukDeepCopy(duk_context* ctx, duk_idx_t idx)
+{
+    idx = duk_normalize_index(ctx, idx);
+    if (!duk_is_object(ctx, idx) || duk_is_function(ctx, idx)) {
+        duk_dup(ctx, idx);
+        return;
+    }
+    if (duk_is_array(ctx, idx))
+        duk_push_array(ctx);
+    else
+        duk_push_object(ctx);
+    duk_enum(ctx, idx, DUK_ENUM_OWN_PROPERTIES_ONLY);
+    while (duk_next(ctx, -1, 1)) {
+        dukDeepCopy(ctx, -1);
+        duk_remove(ctx, -2);
+        duk_put_prop(ctx, -4);
+    }
+    duk_pop(ctx); // enum
+}
+
+std::shared_ptr<CdsObject> Script::getParent(const std::shared_ptr<CdsObject>& obj)
+{
+    auto parentId = obj->getParentID();
+    if (parentId < CDS_ID_ROOT)
+        return nullptr;
+
+    // files of one directory share their parent, load it once per import
+    auto entry = parentCache.find(parentId);
+    if (entry != parentCache.end())
+        return entry->second;
+    auto parent = database->loadObject(parentId);
+    parentCache.emplace(parentId, parent);
+    return parent;
+}
+
+void Script::clearParentCache()
+{
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+    parentCache.clear();
+}
+
+bool Script::hasFunction(const std::string& functionName)
+{
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+    auto result = duk_get_global_string(ctx, functionName.c_str()) && duk_is_function(ctx, -1);
+    duk_pop(ctx);
+    return result;
+}
+
 std::vector<int> Script::call(
     const std::shared_ptr<CdsObject>& obj,
     const std::shared_ptr<CdsContainer>& cont,
@@ -459,11 +583,17 @@ std::vector<int> Script::call(
     const fs::path& rootPath,
     const std::string& containerType)
 {
-    // write global object used in callback functionss
-    cdsObject2dukObject(obj);
-    log_debug("wrote global object {} as {}", obj != nullptr, objectName);
-    duk_put_global_string(ctx, objectName.c_str());
+    return call(obj, cont, functionName, rootPath, containerType, content->getAutoscanDirectory(rootPath));
+}
 
+std::vector<int> Script::call(
+    const std::shared_ptr<CdsObject>& obj,
+    const std::shared_ptr<CdsContainer>& cont,
+    const std::string& functionName,
+    const fs::path& rootPath,
+    const std::string& containerType,
+    const std::shared_ptr<AutoscanDirectory>& autoScan)
+{
     // functionName(object, container, rootPath, autoScanId, containerType)
     // Push function onto stack
     if (!duk_get_global_string(ctx, functionName.c_str()) || !duk_is_function(ctx, -1)) {
@@ -478,8 +608,13 @@ std::vector<int> Script::call(
     cdsObject2dukObject(obj);
     narg++;
 
+    // write global object used in callback functions, the script may modify its argument
+    dukDeepCopy(ctx, -1);
+    log_debug("wrote global object {} as {}", obj != nullptr, objectName);
+    duk_put_global_string(ctx, objectName.c_str());
+
     // Push cont structure onto stack
-    auto par = cont ? cont : (obj->getParentID() >= CDS_ID_ROOT ? database->loadObject(obj->getParentID()) : nullptr);
+    auto par = cont ? cont : getParent(obj);
     cdsObject2dukObject(par ? par : obj);
     narg++;
 
@@ -487,8 +622,6 @@ std::vector<int> Script::call(
     duk_push_sprintf(ctx, "%s", rootPath.c_str());
     narg++;
 
-    auto autoScan = content->getAutoscanDirectory(rootPath);
-
     if (autoScan && !rootPath.empty()) {
         // Push autoScanId onto stack
         duk_push_sprintf(ctx, "%d", autoScan->getScanID());
@@ -520,6 +653,93 @@ std::vector<int> Script::call(
     return result;
 }
 
+std::vector<std::vector<int>> Script::callItems(
+    const std::vector<CallItem>& items,
+    const std::string& functionName,
+    const fs::path& rootPath,
+    const std::shared_ptr<AutoscanDirectory>& autoScan)
+{
+    // functionName(items, rootPath, autoScanId)
+    // Push function onto stack
+    if (!duk_get_global_string(ctx, functionName.c_str()) || !duk_is_function(ctx, -1)) {
+        log_error("javascript function not found: {}()", functionName);
+        duk_pop(ctx);
+        throw_std_runtime_error("javascript function not found: {}()", functionName);
+    }
+
+    int narg = 0;
+
+    // Push items onto stack, global array gets a copy of each object
+    duk_push_array(ctx);
+    duk_push_array(ctx);
+    for (std::size_t index = 0; index < items.size(); index++) {
+        auto&& item = items.at(index);
+        auto arrIndex = static_cast<duk_uarridx_t>(index);
+        duk_push_object(ctx);
+        // stack: function orig items item
+        cdsObject2dukObject(item.object);
+        dukDeepCopy(ctx, -1);
+        duk_put_prop_index(ctx, -5, arrIndex);
+        duk_put_prop_string(ctx, -2, "obj");
+        putBatchIndex(ctx, -1, index);
+
+        auto par = item.container ? item.container : getParent(item.object);
+        cdsObject2dukObject(par ? par : item.object);
+        duk_put_prop_string(ctx, -2, "cont");
+
+        duk_push_string(ctx, item.containerType.c_str());
+        duk_put_prop_string(ctx, -2, "containerType");
+        duk_push_string(ctx, item.mediaType.c_str());
+        duk_put_prop_string(ctx, -2, "mediaType");
+        duk_put_prop_index(ctx, -2, arrIndex);
+    }
+    // write global array used in callback functions
+    duk_swap_top(ctx, -2);
+    log_debug("wrote global array of {} objects as {}", items.size(), objectName);
+    duk_put_global_string(ctx, objectName.c_str());
+    narg++;
+
+    // push rootPath onto stack
+    duk_push_sprintf(ctx, "%s", rootPath.c_str());
+    narg++;
+
+    // Push autoScanId onto stack
+    duk_push_sprintf(ctx, "%d", autoScan && !rootPath.empty() ? autoScan->getScanID() : -1);
+    narg++;
+
+    if (duk_pcall(ctx, static_cast<duk_idx_t>(narg)) != DUK_EXEC_SUCCESS) {
+        log_error("javascript {} runtime error: {}() - {}\n", contextName, functionName, duk_safe_to_stacktrace(ctx, -1));
+        duk_pop(ctx);
+        throw_std_runtime_error("javascript runtime error");
+    }
+
+    // one result array for each item
+    std::vector<std::vector<int>> result;
+    result.reserve(items.size());
+    if (!duk_is_array(ctx, -1)) {
+        if (needResult)
+            log_warning("Function '{}' did not return an array!", functionName);
+        result.resize(items.size());
+    } else {
+        for (std::size_t index = 0; index < items.size(); index++) {
+            duk_get_prop_index(ctx, -1, static_cast<duk_uarridx_t>(index));
+            result.push_back(ScriptResultProperty(ctx).getIntArrayValue());
+            duk_pop(ctx);
+        }
+    }
+
+    duk_pop(ctx);
+    return result;
+}
+
+std::optional<std::size_t> Script::getProcessedIndex(int objectId) const
+{
+    auto entry = std::find_if(processedItems.begin(), processedItems.end(), [objectId](auto&& obj) { return obj->getID() == objectId; });
+    if (entry == processedItems.end())
+        return {};
+    return static_cast<std::size_t>(std::distance(processedItems.begin(), entry));
+}
+
 void Script::setMetaData(
     const std::shared_ptr<CdsObject>& obj,
     const std::shared_ptr<CdsItem>& item,
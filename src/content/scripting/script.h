@@ -37,11 +37,14 @@
 #include "util/grb_fs.h"
 
 #include <duktape.h>
+#include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 // forward declaration
 enum class AutoscanMediaMode;
+class AutoscanDirectory;
 class CdsContainer;
 class CdsItem;
 class CdsObject;
@@ -49,6 +52,7 @@ class Config;
 class ConfigDefinition;
 class Content;
 class Database;
+class ScriptBytecodeCache;
 class ScriptingRuntime;
 class StringConverter;
 class ConverterManager;
@@ -107,6 +111,10 @@ public:
     void loadContent();
     /// @brief load all js files from folder
     void loadFolder(const fs::path& scriptFolder);
+    /// @brief check whether script defines global function
+    bool hasFunction(const std::string& functionName);
+    /// @brief forget loaded parent containers, they may have been changed or removed
+    void clearParentCache();
 
     /// @brief Convert javascript object back to CdsObject
     /// @param pcd Parent object that was added to the script context
@@ -132,6 +140,17 @@ public:
         = 0;
     /// @brief get script belonging to duktape context
     static Script* getContextScript(duk_context* ctx);
+    /// @brief push function of script file, compiled or taken from bytecodeCache
+    /// @return true if the function was loaded from the cache
+    static bool loadFunction(
+        duk_context* ctx,
+        const std::shared_ptr<ScriptBytecodeCache>& bytecodeCache,
+        const fs::path& scriptPath,
+        const std::shared_ptr<StringConverter>& j2i);
+    /// @brief mark the batch item at itemIdx with its position in the batch
+    static void putBatchIndex(duk_context* ctx, duk_idx_t itemIdx, std::size_t index);
+    /// @brief position of the batch item given at idx, either the item itself or its index
+    static std::optional<std::size_t> getBatchIndex(duk_context* ctx, duk_idx_t idx);
 
     /// @brief the database target
     std::shared_ptr<Database> getDatabase() const { return database; }
@@ -141,6 +160,12 @@ public:
     std::string getOrigName() const { return objectName; }
     /// @brief CdsObject currently processed by script
     std::shared_ptr<CdsObject> getProcessedObject() const { return processed; }
+    /// @brief position of object in current batch call, global js variable is an array then
+    std::optional<std::size_t> getProcessedIndex(int objectId) const;
+    /// @brief CdsObject of current batch call
+    std::shared_ptr<CdsObject> getProcessedObject(std::size_t index) const { return processedItems.at(index); }
+    /// @brief index of the runtime heap the script is running on
+    std::size_t getHeap() const { return heap; }
 
 protected:
     Script(
@@ -149,7 +174,8 @@ protected:
         const std::string& name,
         std::string objName,
         bool needResult,
-        std::shared_ptr<StringConverter> sc);
+        std::shared_ptr<StringConverter> sc,
+        std::size_t heap = 0);
 
     /// @brief call js function to generate layout for object
     std::vector<int> call(
@@ -158,6 +184,28 @@ protected:
         const std::string& functionName,
         const fs::path& rootPath,
         const std::string& containerType);
+    /// @brief call js function with autoscan directory already resolved by caller
+    std::vector<int> call(
+        const std::shared_ptr<CdsObject>& obj,
+        const std::shared_ptr<CdsContainer>& cont,
+        const std::string& functionName,
+        const fs::path& rootPath,
+        const std::string& containerType,
+        const std::shared_ptr<AutoscanDirectory>& autoScan);
+
+    /// @brief object with its arguments for batch call
+    struct CallItem {
+        std::shared_ptr<CdsObject> object;
+        std::shared_ptr<CdsContainer> container;
+        std::string containerType;
+        std::string mediaType;
+    };
+    /// @brief call js function to generate layout for several objects, returns result per object
+    std::vector<std::vector<int>> callItems(
+        const std::vector<CallItem>& items,
+        const std::string& functionName,
+        const fs::path& rootPath,
+        const std::shared_ptr<AutoscanDirectory>& autoScan);
     void setMetaData(
         const std::shared_ptr<CdsObject>& obj,
         const std::shared_ptr<CdsItem>& item,
@@ -183,6 +231,8 @@ protected:
     int gc_counter {};
     /// @brief object that is currently being processed by the script (set in import script)
     std::shared_ptr<CdsObject> processed;
+    /// @brief objects that are currently being processed by a batch call
+    std::vector<std::shared_ptr<CdsObject>> processedItems;
 
     duk_context* ctx;
 
@@ -194,6 +244,7 @@ protected:
     std::shared_ptr<ScriptingRuntime> runtime;
     std::shared_ptr<StringConverter> sc;
     std::string contextName;
+    std::size_t heap;
 
 private:
     bool hasCaseSensitiveNames;
@@ -201,6 +252,9 @@ private:
     std::string entrySeparator;
     std::string objectName;
     std::string scriptPath;
+    /// @brief parents of objects without container loaded during the current import
+    std::map<int, std::shared_ptr<CdsObject>> parentCache;
+    std::shared_ptr<CdsObject> getParent(const std::shared_ptr<CdsObject>& obj);
     void _load(const fs::path& scriptPath);
     void _execute();
     std::shared_ptr<StringConverter> _p2i;
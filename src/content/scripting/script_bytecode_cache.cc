@@ -0,0 +1,177 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    script_bytecode_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/scripting/script_bytecode_cache.cc
+
+#ifdef HAVE_JS
+#define GRB_LOG_FAC GrbLogFacility::script
+
+#include "script_bytecode_cache.h" // API
+
+#include "util/logger.h"
+#include "util/tools.h"
+
+#include <algorithm>
+#include <sstream>
+
+/// @brief first line of cache files, followed by the version
+static constexpr std::string_view CACHE_FILE_MAGIC = "GRBJSBC1 ";
+
+/// @brief modification time in file clock ticks, stable between calls
+static std::int64_t getModificationTime(const fs::path& path, std::error_code& ec)
+{
+    return fs::last_write_time(path, ec).time_since_epoch().count();
+}
+
+ScriptBytecodeCache::ScriptBytecodeCache(fs::path cacheDir, std::string version)
+    : cacheDir(std::move(cacheDir))
+    , version(std::move(version))
+{
+    std::error_code ec;
+    fs::create_directories(this->cacheDir, ec);
+    if (ec)
+        log_warning("Failed to create script cache {}: {}", this->cacheDir.string(), ec.message());
+}
+
+fs::path ScriptBytecodeCache::getCacheFile(const fs::path& scriptPath) const
+{
+    return cacheDir / fmt::format("{}.bc", hexStringMd5(scriptPath.string()));
+}
+
+std::optional<std::vector<std::byte>> ScriptBytecodeCache::get(const fs::path& scriptPath)
+{
+    std::error_code ec;
+    auto size = fs::file_size(scriptPath, ec);
+    if (ec)
+        return {};
+    auto mtime = getModificationTime(scriptPath, ec);
+    if (ec)
+        return {};
+
+    AutoLock lock(mutex);
+    auto entry = entries.find(scriptPath);
+    if (entry == entries.end()) {
+        auto fileEntry = readEntry(scriptPath);
+        if (!fileEntry)
+            return {};
+        entry = entries.emplace(scriptPath, std::move(*fileEntry)).first;
+    }
+    if (entry->second.size != size)
+        return {};
+
+    if (entry->second.mtime != mtime) {
+        // file was touched, content may be unchanged
+        std::string scriptText = GrbFile(scriptPath).readTextFile();
+        if (hexStringMd5(scriptText) != entry->second.sourceHash)
+            return {};
+        entry->second.mtime = mtime;
+        writeEntry(scriptPath, entry->second);
+    }
+    log_debug("Using cached bytecode for {}", scriptPath.string());
+    return entry->second.bytecode;
+}
+
+void ScriptBytecodeCache::set(const fs::path& scriptPath, std::string_view scriptText, const std::vector<std::byte>& bytecode)
+{
+    std::error_code ec;
+    auto mtime = getModificationTime(scriptPath, ec);
+    if (ec)
+        return;
+
+    auto entry = Entry { mtime, scriptText.size(), hexStringMd5(scriptText), bytecode };
+    AutoLock lock(mutex);
+    writeEntry(scriptPath, entry);
+    entries.insert_or_assign(scriptPath, std::move(entry));
+}
+
+std::optional<ScriptBytecodeCache::Entry> ScriptBytecodeCache::readEntry(const fs::path& scriptPath) const
+{
+    auto cacheFile = getCacheFile(scriptPath);
+    std::error_code ec;
+    if (!fs::is_regular_file(cacheFile, ec))
+        return {};
+
+    std::optional<std::vector<std::byte>> data;
+    try {
+        data = GrbFile(cacheFile).readBinaryFile();
+    } catch (const std::runtime_error& e) {
+        log_warning("Failed to read script cache {}: {}", cacheFile.string(), e.what());
+    }
+    if (!data)
+        return {};
+
+    // header: magic and version, then script path, then mtime size source-md5 bytecode-md5
+    auto text = std::string_view(reinterpret_cast<const char*>(data->data()), data->size());
+    std::size_t headerEnd = 0;
+    for (int line = 0; line < 3 && headerEnd != std::string_view::npos; line++) {
+        headerEnd = text.find('\n', headerEnd);
+        if (headerEnd != std::string_view::npos)
+            headerEnd++;
+    }
+    if (headerEnd == std::string_view::npos)
+        return {};
+
+    auto header = std::istringstream(std::string(text.substr(0, headerEnd)));
+    std::string versionLine;
+    std::string pathLine;
+    std::getline(header, versionLine);
+    std::getline(header, pathLine);
+    if (versionLine != fmt::format("{}{}", CACHE_FILE_MAGIC, version) || pathLine != scriptPath.string())
+        return {};
+
+    Entry entry;
+    std::string bytecodeHash;
+    if (!(header >> entry.mtime >> entry.size >> entry.sourceHash >> bytecodeHash))
+        return {};
+
+    entry.bytecode.assign(data->begin() + headerEnd, data->end());
+    if (entry.bytecode.empty() || hexMd5(entry.bytecode.data(), entry.bytecode.size()) != bytecodeHash) {
+        log_warning("Ignoring damaged script cache {}", cacheFile.string());
+        return {};
+    }
+    return entry;
+}
+
+void ScriptBytecodeCache::writeEntry(const fs::path& scriptPath, const Entry& entry) const
+{
+    auto header = fmt::format("{}{}\n{}\n{} {} {} {}\n", CACHE_FILE_MAGIC, version, scriptPath.string(),
+        entry.mtime, entry.size, entry.sourceHash, hexMd5(entry.bytecode.data(), entry.bytecode.size()));
+    std::vector<std::byte> data(header.size() + entry.bytecode.size());
+    std::transform(header.begin(), header.end(), data.begin(), [](char c) { return std::byte(c); });
+    std::copy(entry.bytecode.begin(), entry.bytecode.end(), data.begin() + header.size());
+
+    // write to temporary file so readers never see partial content
+    auto cacheFile = getCacheFile(scriptPath);
+    auto tmpFile = fs::path(fmt::format("{}.tmp", cacheFile.string()));
+    try {
+        GrbFile(tmpFile).writeBinaryFile(data.data(), data.size());
+        std::error_code ec;
+        fs::rename(tmpFile, cacheFile, ec);
+        if (ec)
+            log_warning("Failed to store script cache {}: {}", cacheFile.string(), ec.message());
+    } catch (const std::runtime_error& e) {
+        log_warning("Failed to write script cache {}: {}", cacheFile.string(), e.what());
+    }
+}
+
+#endif // HAVE_JS
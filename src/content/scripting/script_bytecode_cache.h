@@ -0,0 +1,75 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    script_bytecode_cache.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file content/scripting/script_bytecode_cache.h
+/// @brief Definition of the ScriptBytecodeCache class.
+
+#ifndef __SCRIPTING_SCRIPT_BYTECODE_CACHE_H__
+#define __SCRIPTING_SCRIPT_BYTECODE_CACHE_H__
+
+#include "util/grb_fs.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Keeps compiled scripts in memory and in files below the cache directory
+///
+/// Entries are keyed by the script path and checked against modification time, size and md5 sum
+/// of the script source. The version string must change whenever the compiler or the conversion of
+/// the source changes, because the bytecode itself is not validated when it is loaded.
+class ScriptBytecodeCache {
+public:
+    ScriptBytecodeCache(fs::path cacheDir, std::string version);
+
+    /// @brief get bytecode of script if it was compiled from the current file
+    std::optional<std::vector<std::byte>> get(const fs::path& scriptPath);
+    /// @brief store bytecode of script compiled from scriptText as read from disk
+    void set(const fs::path& scriptPath, std::string_view scriptText, const std::vector<std::byte>& bytecode);
+    /// @brief file containing the bytecode of script
+    fs::path getCacheFile(const fs::path& scriptPath) const;
+
+private:
+    struct Entry {
+        std::int64_t mtime {};
+        std::uintmax_t size {};
+        std::string sourceHash;
+        std::vector<std::byte> bytecode;
+    };
+
+    fs::path cacheDir;
+    std::string version;
+    std::map<fs::path, Entry> entries;
+
+    std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+
+    std::optional<Entry> readEntry(const fs::path& scriptPath) const;
+    void writeEntry(const fs::path& scriptPath, const Entry& entry) const;
+};
+
+#endif // __SCRIPTING_SCRIPT_BYTECODE_CACHE_H__
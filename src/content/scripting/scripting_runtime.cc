@@ -36,29 +36,62 @@
 
 #include "scripting_runtime.h" // API
 
+#include "exceptions.h"
 #include "script.h"
+#include "script_bytecode_cache.h"
 #include "util/logger.h"
 
-ScriptingRuntime::ScriptingRuntime()
-    : ctx(duk_create_heap(nullptr, nullptr, nullptr, nullptr, [](auto, auto msg) { log_error("Fatal Duktape error: {}", msg ? msg : "no message"); std::abort(); }))
+#include <algorithm>
+
+ScriptingRuntime::ScriptingRuntime(std::size_t heapCount, const fs::path& cacheDir, const std::string& charset)
 {
+    heaps.reserve(std::max<std::size_t>(heapCount, 1));
+    for (std::size_t heap = 0; heap < std::max<std::size_t>(heapCount, 1); heap++) {
+        auto ctx = duk_create_heap(nullptr, nullptr, nullptr, nullptr, [](auto, auto msg) { log_error("Fatal Duktape error: {}", msg ? msg : "no message"); std::abort(); });
+        if (!ctx)
+            throw_std_runtime_error("Scripting: could not create js heap {}", heap);
+        heaps.push_back(std::make_unique<Heap>());
+        heaps.back()->ctx = ctx;
+    }
+    log_debug("Created {} js heap(s)", heaps.size());
+
+    if (!cacheDir.empty()) {
+        // bytecode depends on the engine and the conversion of the source
+        bytecodeCache = std::make_shared<ScriptBytecodeCache>(cacheDir, fmt::format("duktape {} {}", DUK_VERSION, charset));
+    }
 }
 
 ScriptingRuntime::~ScriptingRuntime()
 {
-    duk_destroy_heap(ctx);
+    for (auto&& heap : heaps) {
+        duk_destroy_heap(heap->ctx);
+    }
+}
+
+void ScriptingRuntime::addScript(const std::shared_ptr<Script>& script)
+{
+    std::scoped_lock<std::mutex> lock(scriptMutex);
+    activeScripts.push_back(script);
+}
+
+std::vector<std::shared_ptr<Script>> ScriptingRuntime::getScripts() const
+{
+    std::scoped_lock<std::mutex> lock(scriptMutex);
+    return activeScripts;
 }
 
 bool ScriptingRuntime::reloadFolders()
 {
-    for (auto&& script : activeScripts) {
+    for (auto&& script : getScripts()) {
+        AutoLock lock(getMutex(script->getHeap()));
         script->loadContent();
     }
     return true;
 }
 
-duk_context* ScriptingRuntime::createContext(const std::string& name)
+duk_context* ScriptingRuntime::createContext(const std::string& name, std::size_t heap)
 {
+    auto ctx = heaps.at(heap)->ctx;
     duk_push_heap_stash(ctx);
     duk_idx_t threadIdx = duk_push_thread_new_globalenv(ctx);
     duk_context* newctx = duk_get_context(ctx, threadIdx);
@@ -67,8 +100,9 @@ duk_context* ScriptingRuntime::createContext(const std::string& name)
     return newctx;
 }
 
-void ScriptingRuntime::destroyContext(const std::string& name)
+void ScriptingRuntime::destroyContext(const std::string& name, std::size_t heap)
 {
+    auto ctx = heaps.at(heap)->ctx;
     duk_push_heap_stash(ctx);
     duk_del_prop_string(ctx, -1, name.c_str());
     duk_pop(ctx);
@@ -34,6 +34,8 @@
 #ifndef __SCRIPTING_RUNTIME_H__
 #define __SCRIPTING_RUNTIME_H__
 
+#include "util/grb_fs.h"
+
 #include <duktape.h>
 #include <memory>
 #include <mutex>
@@ -42,35 +44,55 @@
 
 // forward declarations
 class Script;
+class ScriptBytecodeCache;
 
 /// @brief ScriptingRuntime class definition.
+///
+/// The runtime owns one or more independent duktape heaps. Scripts on different heaps can run in parallel,
+/// scripts on the same heap are serialised by the mutex of the heap.
 class ScriptingRuntime {
 protected:
-    duk_context* ctx;
-    mutable std::recursive_mutex mutex;
-
+    /// @brief duktape heap with its lock
+    struct Heap {
+        duk_context* ctx;
+        std::recursive_mutex mutex;
+    };
+    std::vector<std::unique_ptr<Heap>> heaps;
+
+    mutable std::mutex scriptMutex;
     std::vector<std::shared_ptr<Script>> activeScripts;
 
+    std::shared_ptr<ScriptBytecodeCache> bytecodeCache;
+
 public:
-    ScriptingRuntime();
+    /// @brief create runtime
+    /// @param heapCount number of independent heaps
+    /// @param cacheDir directory for compiled scripts, no cache if empty
+    /// @param charset character set of the scripts
+    explicit ScriptingRuntime(std::size_t heapCount = 1, const fs::path& cacheDir = {}, const std::string& charset = {});
     virtual ~ScriptingRuntime();
 
     ScriptingRuntime(const ScriptingRuntime&) = delete;
     ScriptingRuntime& operator=(const ScriptingRuntime&) = delete;
 
     /// @brief script listens to changes in folders
-    void addScript(const std::shared_ptr<Script>& script) { activeScripts.push_back(script); }
+    void addScript(const std::shared_ptr<Script>& script);
     /// @brief get scripts
-    const std::vector<std::shared_ptr<Script>>& getScripts() { return activeScripts; }
+    std::vector<std::shared_ptr<Script>> getScripts() const;
     /// @brief reload scripts in folders
     bool reloadFolders();
 
-    /// @brief Returns a new (sub)context. !!! Not thread-safe !!!
-    duk_context* createContext(const std::string& name);
-    void destroyContext(const std::string& name);
+    /// @brief number of independent heaps
+    std::size_t getHeapCount() const { return heaps.size(); }
+    /// @brief cache for compiled scripts, may be nullptr
+    std::shared_ptr<ScriptBytecodeCache> getBytecodeCache() const { return bytecodeCache; }
+
+    /// @brief Returns a new (sub)context on heap. !!! Not thread-safe, lock heap mutex !!!
+    duk_context* createContext(const std::string& name, std::size_t heap = 0);
+    void destroyContext(const std::string& name, std::size_t heap = 0);
 
     using AutoLock = std::scoped_lock<std::recursive_mutex>;
-    std::recursive_mutex& getMutex() const { return mutex; }
+    std::recursive_mutex& getMutex(std::size_t heap = 0) const { return heaps.at(heap)->mutex; }
 };
 
 #endif // __SCRIPTING_RUNTIME_H__
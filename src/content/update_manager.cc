@@ -38,6 +38,7 @@
 
 #include "database/database.h"
 #include "server.h"
+#include "upnp/browse_result_cache.h"
 #include "upnp/upnp_common.h"
 #include "util/grb_time.h"
 
@@ -88,6 +89,7 @@ void UpdateManager::shutdown()
 void UpdateManager::containersChanged(const std::vector<int>& objectIDs, int flushPolicy)
 {
     log_debug("start");
+    invalidateResults(objectIDs);
     auto lock = threadRunner->uniqueLock();
     // signalling thread if it could have been idle, because
     // there were no unprocessed updates
@@ -131,6 +133,7 @@ void UpdateManager::containerChanged(int objectID, int flushPolicy)
     if (objectID == INVALID_OBJECT_ID)
         return;
 
+    invalidateResults({ objectID });
     auto lock = threadRunner->lockGuard();
 
     if (objectID != lastContainerChanged || flushPolicy > this->flushPolicy) {
@@ -162,8 +165,20 @@ void UpdateManager::containerChanged(int objectID, int flushPolicy)
     }
 }
 
+void UpdateManager::resultsChanged()
+{
+    if (server && server->getBrowseCache())
+        server->getBrowseCache()->clear();
+}
+
 /* private stuff */
 
+void UpdateManager::invalidateResults(const std::vector<int>& objectIDs) const
+{
+    if (server && server->getBrowseCache())
+        server->getBrowseCache()->invalidate(objectIDs);
+}
+
 void UpdateManager::threadProc()
 {
     log_debug("start");
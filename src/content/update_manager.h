@@ -62,6 +62,8 @@ public:
 
     void containerChanged(int objectID, int flushPolicy = FLUSH_SPEC);
     void containersChanged(const std::vector<int>& objectIDs, int flushPolicy = FLUSH_SPEC);
+    /// @brief drop cached browse results that changed without container update, e.g. play status
+    void resultsChanged();
 
 protected:
     std::shared_ptr<Config> config;
@@ -78,6 +80,8 @@ protected:
     int lastContainerChanged { INVALID_OBJECT_ID };
 
     void threadProc();
+    /// @brief drop cached browse results of changed containers
+    void invalidateResults(const std::vector<int>& objectIDs) const;
 
     bool haveUpdates() const { return !objectIDHash.empty(); }
 };
@@ -0,0 +1,69 @@
+/*GRB*
+  Gerbera - https://gerbera.io/
+
+  browse_cursor.cc - this file is part of Gerbera.
+
+  Copyright (C) 2026 Gerbera Contributors
+
+  Gerbera is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2
+  as published by the Free Software Foundation.
+
+  Gerbera is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+  $Id$
+*/
+
+/// @file database/browse_cursor.cc
+#define GRB_LOG_FAC GrbLogFacility::database
+
+#include "browse_cursor.h" // API
+
+std::optional<BrowseCursor> BrowseCursorCache::get(const std::string& key, int startingIndex)
+{
+    AutoLock lock(mutex);
+    auto entry = entries.find(key);
+    if (entry == entries.end() || entry->second.nextIndex != startingIndex)
+        return {};
+    lruList.splice(lruList.begin(), lruList, entry->second.lru);
+    return entry->second.cursor;
+}
+
+void BrowseCursorCache::set(const std::string& key, int nextIndex, const BrowseCursor& cursor)
+{
+    AutoLock lock(mutex);
+    if (maxSize == 0)
+        return;
+    auto entry = entries.find(key);
+    if (entry != entries.end()) {
+        entry->second.nextIndex = nextIndex;
+        entry->second.cursor = cursor;
+        lruList.splice(lruList.begin(), lruList, entry->second.lru);
+        return;
+    }
+    if (entries.size() >= maxSize) {
+        entries.erase(lruList.back());
+        lruList.pop_back();
+    }
+    lruList.push_front(key);
+    entries.emplace(key, Entry { nextIndex, cursor, lruList.begin() });
+}
+
+void BrowseCursorCache::clear()
+{
+    AutoLock lock(mutex);
+    entries.clear();
+    lruList.clear();
+}
+
+std::size_t BrowseCursorCache::size() const
+{
+    AutoLock lock(mutex);
+    return entries.size();
+}
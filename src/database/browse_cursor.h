@@ -0,0 +1,77 @@
+/*GRB*
+  Gerbera - https://gerbera.io/
+
+  browse_cursor.h - this file is part of Gerbera.
+
+  Copyright (C) 2026 Gerbera Contributors
+
+  Gerbera is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2
+  as published by the Free Software Foundation.
+
+  Gerbera is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+  $Id$
+*/
+
+/// @file database/browse_cursor.h
+/// @brief Definition of the BrowseCursor and BrowseCursorCache classes.
+
+#ifndef __BROWSE_CURSOR_H__
+#define __BROWSE_CURSOR_H__
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+/// @brief Sort values of the last row returned by a browse request
+struct BrowseCursor {
+    int objectType {};
+    std::optional<std::string> upnpClass;
+    std::optional<std::string> sortValue;
+    int id {};
+};
+
+/// @brief Remembers where a client stopped paging through a container
+///
+/// The next page of the same request can be selected by seeking behind the last row instead of skipping
+/// all previous rows with OFFSET. Requests with another starting index do not find a cursor.
+class BrowseCursorCache {
+public:
+    explicit BrowseCursorCache(std::size_t maxSize)
+        : maxSize(maxSize)
+    {
+    }
+
+    /// @brief get cursor of request key if it continues at startingIndex
+    std::optional<BrowseCursor> get(const std::string& key, int startingIndex);
+    /// @brief store cursor of request key for a request starting at nextIndex
+    void set(const std::string& key, int nextIndex, const BrowseCursor& cursor);
+    void clear();
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        int nextIndex;
+        BrowseCursor cursor;
+        std::list<std::string>::iterator lru;
+    };
+
+    std::size_t maxSize;
+    std::unordered_map<std::string, Entry> entries;
+    /// @brief keys, most recently used first
+    std::list<std::string> lruList;
+
+    mutable std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+};
+
+#endif // __BROWSE_CURSOR_H__
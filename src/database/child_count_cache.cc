@@ -0,0 +1,139 @@
+/*GRB*
+  Gerbera - https://gerbera.io/
+
+  child_count_cache.cc - this file is part of Gerbera.
+
+  Copyright (C) 2026 Gerbera Contributors
+
+  Gerbera is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2
+  as published by the Free Software Foundation.
+
+  Gerbera is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+  $Id$
+*/
+
+/// @file database/child_count_cache.cc
+#define GRB_LOG_FAC GrbLogFacility::database
+
+#include "child_count_cache.h" // API
+
+#include "cds/cds_enums.h"
+
+bool ChildCountCache::get(int containerId, bool containers, bool items, int& count) const
+{
+    AutoLock lock(mutex);
+    if (pending.find(containerId) != pending.end())
+        return false;
+    auto entry = counts.find(containerId);
+    if (entry == counts.end())
+        return false;
+
+    count = entry->second.get(containers, items);
+    return true;
+}
+
+void ChildCountCache::set(int containerId, const Counts& newCounts, std::uint64_t readGeneration)
+{
+    AutoLock lock(mutex);
+    if (maxSize == 0 || readGeneration != generation || pending.find(containerId) != pending.end())
+        return;
+    if (counts.size() >= maxSize && counts.find(containerId) == counts.end())
+        counts.erase(counts.begin());
+    counts.insert_or_assign(containerId, newCounts);
+}
+
+std::uint64_t ChildCountCache::getGeneration() const
+{
+    AutoLock lock(mutex);
+    return generation;
+}
+
+void ChildCountCache::startChange(int parentId)
+{
+    AutoLock lock(mutex);
+    ++generation;
+    ++pending[parentId];
+}
+
+void ChildCountCache::finishChange(int parentId, unsigned int objectType, int delta)
+{
+    AutoLock lock(mutex);
+    ++generation;
+    auto running = pending.find(parentId);
+    if (running != pending.end() && --running->second <= 0)
+        pending.erase(running);
+
+    auto entry = counts.find(parentId);
+    if (entry == counts.end())
+        return;
+    entry->second.total += delta;
+    if (objectType == OBJECT_TYPE_CONTAINER)
+        entry->second.containers += delta;
+    if ((objectType & OBJECT_TYPE_ITEM) == OBJECT_TYPE_ITEM)
+        entry->second.items += delta;
+    if (entry->second.total < 0 || entry->second.containers < 0 || entry->second.items < 0)
+        counts.erase(entry);
+}
+
+void ChildCountCache::abortChange(int parentId)
+{
+    AutoLock lock(mutex);
+    ++generation;
+    auto running = pending.find(parentId);
+    if (running != pending.end() && --running->second <= 0)
+        pending.erase(running);
+    counts.erase(parentId);
+}
+
+void ChildCountCache::erase(int containerId)
+{
+    AutoLock lock(mutex);
+    ++generation;
+    counts.erase(containerId);
+}
+
+void ChildCountCache::clear()
+{
+    AutoLock lock(mutex);
+    ++generation;
+    counts.clear();
+}
+
+std::size_t ChildCountCache::size() const
+{
+    AutoLock lock(mutex);
+    return counts.size();
+}
+
+ChildCountCache::Change::~Change()
+{
+    if (!cache)
+        return;
+    for (auto&& entry : deltas)
+        cache->abortChange(entry.parentId);
+}
+
+void ChildCountCache::Change::add(int parentId, unsigned int objectType, int delta)
+{
+    if (!cache || delta == 0)
+        return;
+    cache->startChange(parentId);
+    deltas.push_back({ parentId, objectType, delta });
+}
+
+void ChildCountCache::Change::apply()
+{
+    if (!cache)
+        return;
+    for (auto&& entry : deltas)
+        cache->finishChange(entry.parentId, entry.objectType, entry.delta);
+    deltas.clear();
+}
@@ -0,0 +1,131 @@
+/*GRB*
+  Gerbera - https://gerbera.io/
+
+  child_count_cache.h - this file is part of Gerbera.
+
+  Copyright (C) 2026 Gerbera Contributors
+
+  Gerbera is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2
+  as published by the Free Software Foundation.
+
+  Gerbera is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+  $Id$
+*/
+
+/// @file database/child_count_cache.h
+/// @brief Definition of the ChildCountCache class.
+
+#ifndef __CHILD_COUNT_CACHE_H__
+#define __CHILD_COUNT_CACHE_H__
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Number of children per container, split by object type
+///
+/// Counts are filled from database queries and changed incrementally when objects are added, moved or removed.
+/// Writers mark the parent as pending before the database is changed and apply the change after commit.
+/// Pending containers are not answered from the cache and counts read while a change was running are not stored.
+class ChildCountCache {
+public:
+    struct Counts {
+        /// @brief children with object type container
+        int containers {};
+        /// @brief children with object type item
+        int items {};
+        /// @brief all children
+        int total {};
+
+        /// @brief count of children matching the type filter
+        int get(bool withContainers, bool withItems) const
+        {
+            if (withContainers && withItems)
+                return total;
+            if (withContainers)
+                return containers;
+            if (withItems)
+                return items;
+            return 0;
+        }
+    };
+
+    explicit ChildCountCache(std::size_t maxSize)
+        : maxSize(maxSize)
+    {
+    }
+
+    /// @brief get count of children matching the type filter
+    /// @return false if container is not cached or currently changed
+    bool get(int containerId, bool containers, bool items, int& count) const;
+    /// @brief store counts read from database
+    /// @param generation value of getGeneration() before the database was read
+    void set(int containerId, const Counts& counts, std::uint64_t generation);
+    /// @brief counter that increases with each change
+    std::uint64_t getGeneration() const;
+
+    /// @brief announce a change of the children of parentId
+    void startChange(int parentId);
+    /// @brief apply change of children of parentId after it is stored in database
+    /// @param objectType type of the added or removed child
+    /// @param delta number of added (positive) or removed (negative) children
+    void finishChange(int parentId, unsigned int objectType, int delta);
+    /// @brief release a change that was not stored and drop the counts of parentId
+    void abortChange(int parentId);
+
+    /// @brief Collects changes of a database operation and applies them after commit
+    ///
+    /// If the operation fails before apply() is called the counts of all affected containers are dropped.
+    class Change {
+    public:
+        explicit Change(ChildCountCache* cache)
+            : cache(cache)
+        {
+        }
+        ~Change();
+        Change(const Change&) = delete;
+        Change& operator=(const Change&) = delete;
+
+        /// @brief record that delta children of objectType are added to or removed from parentId
+        void add(int parentId, unsigned int objectType, int delta);
+        /// @brief apply recorded changes to the cache
+        void apply();
+
+    private:
+        struct Delta {
+            int parentId;
+            unsigned int objectType;
+            int delta;
+        };
+        ChildCountCache* cache;
+        std::vector<Delta> deltas;
+    };
+
+    /// @brief drop counts of a container, e.g. when it is removed
+    void erase(int containerId);
+    void clear();
+
+    bool isEnabled() const { return maxSize > 0; }
+    std::size_t size() const;
+
+private:
+    std::size_t maxSize;
+    std::uint64_t generation {};
+    std::unordered_map<int, Counts> counts;
+    /// @brief number of running changes per container
+    std::unordered_map<int, int> pending;
+
+    mutable std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+};
+
+#endif // __CHILD_COUNT_CACHE_H__
@@ -35,7 +35,9 @@
 #define __GRB_DATABASE_H__
 
 #include "util/grb_fs.h"
+#include "util/string_pool.h"
 
+#include <chrono>
 #include <map>
 #include <unordered_set>
 #include <vector>
@@ -90,6 +92,17 @@ enum class DbFileType {
     All,
 };
 
+/// @brief Values of a file or directory object to check it during import without loading it
+struct DbPathEntry {
+    int id;
+    int parentId;
+    int refId;
+    unsigned int objectType;
+    CdsEntryType entryType;
+    InternedString upnpClass;
+    std::chrono::seconds mtime;
+};
+
 class Database {
 public:
     explicit Database(std::shared_ptr<Config> config);
@@ -113,6 +126,9 @@ public:
     virtual void dropTables() = 0;
 
     virtual void addObject(const std::shared_ptr<CdsObject>& object, int* changedContainer) = 0;
+    /// @brief add several new objects, in one transaction if transactions are enabled
+    /// metadata and resources of all objects are written with one statement per table
+    virtual void addObjects(const std::vector<std::shared_ptr<CdsObject>>& objects, int* changedContainer) = 0;
 
     /// @brief Adds a virtual container chain specified by path.
     /// @param parentContainerId the id of the parent container
@@ -174,6 +190,10 @@ public:
         const std::string& group,
         DbFileType fileType = DbFileType::Auto)
         = 0;
+    /// @brief get all files and directories at path and below with one query
+    /// @param path root of the file system tree
+    /// @return entries by location, a location can have several entries with references
+    virtual std::vector<std::pair<fs::path, DbPathEntry>> getPathEntries(const fs::path& path) = 0;
 
     /// @brief increments the updateIDs for the given objectIDs
     /// @param ids pointer to the array of ids
@@ -306,6 +326,8 @@ public:
     virtual void threadCleanup() = 0;
     virtual bool threadCleanupRequired() const = 0;
     virtual int getFirstVersion() const { return 1; };
+    /// @brief runtime counters of the database driver, e.g. connection usage and queue wait times
+    virtual std::map<std::string, long long> getDriverStats() const { return {}; }
 
 protected:
     static std::shared_ptr<Database> createInstance(const std::shared_ptr<Config>& config,
@@ -93,6 +93,7 @@ protected:
 
     bool showDynamicContainers { true };
     std::vector<ObjectSource> sources;
+    std::string session;
 
 public:
     BrowseParam(std::shared_ptr<CdsObject> object, unsigned int flags)
@@ -117,6 +118,10 @@ public:
 
     void addSource(ObjectSource source) { this->sources.push_back(source); }
     const std::vector<ObjectSource>& getSources() const { return sources; }
+
+    /// @brief identification of the requesting client to continue paging
+    void setSession(const std::string& session) { this->session = session; }
+    const std::string& getSession() const { return session; }
 };
 
 /// @brief Parameters for UPnP search request
@@ -46,6 +46,7 @@
 
 #define MYSQL_SET_VERSION "INSERT INTO `mt_internal_setting` VALUES ('db_version','{}')"
 static constexpr auto mysqlUpdateVersion = std::string_view("UPDATE `mt_internal_setting` SET `value`='{}' WHERE `key`='db_version' AND `value`='{}'");
+static constexpr auto mysqlClosureCreate = std::string_view("CREATE TABLE `grb_cds_closure` (`ancestor_id` int(11) NOT NULL, `descendant_id` int(11) NOT NULL, PRIMARY KEY (`ancestor_id`,`descendant_id`), KEY `grb_cds_closure_descendant` (`descendant_id`), CONSTRAINT `grb_cds_closure_fk1` FOREIGN KEY (`ancestor_id`) REFERENCES `mt_cds_object` (`id`) ON DELETE CASCADE, CONSTRAINT `grb_cds_closure_fk2` FOREIGN KEY (`descendant_id`) REFERENCES `mt_cds_object` (`id`) ON DELETE CASCADE) ENGINE={} CHARSET={}");
 static const auto mysqlAddResourceAttr = std::map<ResourceDataType, std::string_view> {
     { ResourceDataType::String, R"(ALTER TABLE `grb_cds_resource` ADD COLUMN `{}` varchar(255) default NULL)" },
     { ResourceDataType::Number, R"(ALTER TABLE `grb_cds_resource` ADD COLUMN `{}` bigint(20) default NULL)" }
@@ -224,6 +225,16 @@ void MySQLDatabase::init()
         log_info("Saving string limit {}", stringLimit);
         storeInternalSetting("string_limit", fmt::to_string(stringLimit));
     }
+    if (fullTextSearch)
+        log_warning("Full-text search is not supported with MySQL");
+    auto engine = config->getOption(ConfigVal::SERVER_STORAGE_MYSQL_ENGINE);
+    // MyISAM ignores foreign keys, closure rows of deleted objects would never be removed
+    if (containerClosure && toLower(engine) == "myisam") {
+        log_warning("Container closure requires foreign key support, not available with engine {}", engine);
+        containerClosure = false;
+    }
+    auto closureCreate = fmt::format(mysqlClosureCreate, engine, config->getOption(ConfigVal::SERVER_STORAGE_MYSQL_CHARSET));
+    initContainerClosure({ closureCreate });
     initDynContainers();
 
     lock.unlock();
@@ -33,6 +33,51 @@
 
 #include <pqxx/pqxx>
 
+/* PGStatementCache */
+
+std::string PGStatementCache::get(pqxx::connection& conn, const std::string& query)
+{
+    auto entry = statements.find(query);
+    if (entry != statements.end()) {
+        usage.splice(usage.begin(), usage, entry->second.second);
+        return entry->second.first;
+    }
+
+    // postgres uses numbered placeholders
+    std::string pgQuery;
+    pgQuery.reserve(query.size() + 16);
+    int index = 0;
+    bool inLiteral = false;
+    for (auto&& chr : query) {
+        if (chr == '\'')
+            inLiteral = !inLiteral;
+        if (chr == '?' && !inLiteral)
+            pgQuery.append(fmt::format("${}", ++index));
+        else
+            pgQuery.push_back(chr);
+    }
+
+    if (statements.size() >= maxSize && !usage.empty()) {
+        auto last = statements.find(usage.back());
+        conn.unprepare(last->second.first);
+        statements.erase(last);
+        usage.pop_back();
+    }
+    auto name = fmt::format("grb_stmt_{}", ++counter);
+    conn.prepare(name, pgQuery);
+    usage.push_front(query);
+    statements.emplace(query, std::make_pair(name, usage.begin()));
+    return name;
+}
+
+void PGStatementCache::clear()
+{
+    statements.clear();
+    usage.clear();
+}
+
+/* PGTask */
+
 PGTask::~PGTask() = default;
 
 bool PGTask::is_running() const
@@ -141,6 +186,49 @@ void PGSelectTask::run(
     pres = std::make_shared<PostgresSQLResult>(res);
 }
 
+/* PGPreparedSelectTask */
+
+PGPreparedSelectTask::PGPreparedSelectTask(const std::string& query, std::vector<SQLParam> params)
+    : PGSelectTask(query)
+    , params(std::move(params))
+{
+}
+
+void PGPreparedSelectTask::run(
+    const std::unique_ptr<pqxx::connection>& conn,
+    PostgresDatabase& pg,
+    bool throwOnError)
+{
+    if (!statementCache) {
+        query = pg.formatPrepared(query, params);
+        PGSelectTask::run(conn, pg, throwOnError);
+        return;
+    }
+    log_debug("Running: {} with {} parameter(s)", query, params.size());
+
+    std::vector<std::string> values;
+    values.reserve(params.size());
+    for (auto&& param : params) {
+        if (std::holds_alternative<long long>(param))
+            values.push_back(fmt::to_string(std::get<long long>(param)));
+        else
+            values.push_back(std::get<std::string>(param));
+    }
+
+    auto name = statementCache->get(*conn, query);
+    pqxx::work txn(*conn);
+#if PQXX_VERSION_MAJOR > 7 || (PQXX_VERSION_MAJOR == 7 && PQXX_VERSION_MINOR >= 7)
+    pqxx::params pqParams;
+    for (auto&& value : values)
+        pqParams.append(value);
+    pqxx::result res = txn.exec_prepared(name, pqParams);
+#else
+    pqxx::result res = txn.exec_prepared(name, pqxx::prepare::make_dynamic_params(values));
+#endif
+    txn.commit();
+    pres = std::make_shared<PostgresSQLResult>(res);
+}
+
 /* PGExecTask */
 
 PGExecTask::PGExecTask(
@@ -24,10 +24,14 @@
 #ifndef __POSTGRES_TASK_H__
 #define __POSTGRES_TASK_H__
 
+#include "database/sql_result.h"
 #include "util/grb_fs.h"
 
 #include <condition_variable>
+#include <list>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 class Config;
 enum class ConfigVal;
@@ -41,6 +45,27 @@ class result;
 
 #define POSTGRES_SET_VERSION "INSERT INTO \"mt_internal_setting\" VALUES('db_version', '{}')"
 
+/// @brief Prepared statements of the connection, least recently used are deallocated first
+class PGStatementCache {
+public:
+    explicit PGStatementCache(std::size_t maxSize)
+        : maxSize(maxSize)
+    {
+    }
+
+    /// @brief get statement name for query with ? placeholders, prepare it if not prepared yet
+    std::string get(pqxx::connection& conn, const std::string& query);
+    /// @brief forget all statements, e.g. after reconnect
+    void clear();
+
+private:
+    std::size_t maxSize;
+    std::size_t counter {};
+    /// @brief queries in order of usage, most recent first
+    std::list<std::string> usage;
+    std::unordered_map<std::string, std::pair<std::string, std::list<std::string>::iterator>> statements;
+};
+
 /// @brief A virtual class that represents a task to be done by the postgres thread.
 class PGTask {
 public:
@@ -80,6 +105,9 @@ public:
 
     virtual bool checkKey(const std::string& key) const { return true; }
 
+    /// @brief set statement cache of the connection running the task
+    void setStatementCache(PGStatementCache* cache) { statementCache = cache; }
+
 protected:
     /// @brief true as long as the task is not finished
     /// The value is set by the constructor to true and then to false be sendSignal()
@@ -96,6 +124,7 @@ protected:
     mutable std::mutex mutex;
 
     std::string error;
+    PGStatementCache* statementCache {};
 };
 
 /// @brief A task for the postgres thread to inititally create the database.
@@ -144,6 +173,25 @@ protected:
     std::shared_ptr<PostgresSQLResult> pres;
 };
 
+/// @brief A task for the postgres thread to do a SQL select with a prepared statement.
+class PGPreparedSelectTask : public PGSelectTask {
+public:
+    /// @brief Constructor for the postgres prepared select task
+    /// @param query The SQL query string with ? as placeholders
+    /// @param params The values for the placeholders
+    PGPreparedSelectTask(const std::string& query, std::vector<SQLParam> params);
+
+    void run(
+        const std::unique_ptr<pqxx::connection>& conn,
+        PostgresDatabase& pg,
+        bool throwOnError = true) override;
+
+    std::string_view taskType() const override { return "PGPreparedSelectTask"; }
+
+protected:
+    std::vector<SQLParam> params;
+};
+
 /// @brief A task for the postgres thread to do a SQL exec.
 class PGExecTask : public PGTask {
 public:
@@ -39,11 +39,23 @@
 #include <netinet/in.h>
 #include <regex>
 
+#define STATEMENT_CACHE_SIZE 64 // prepared statements kept per connection
+
 static constexpr auto postgresUpdateVersion = std::string_view(R"(UPDATE "mt_internal_setting" SET "value"='{}' WHERE "key"='db_version' AND "value"='{}')");
 static const auto postgresAddResourceAttr = std::map<ResourceDataType, std::string_view> {
     { ResourceDataType::String, R"(ALTER TABLE "grb_cds_resource" ADD COLUMN "{}" varchar(255) default NULL)" },
     { ResourceDataType::Number, R"(ALTER TABLE "grb_cds_resource" ADD COLUMN "{}" bigint default NULL)" }
 };
+/// @brief trigram index supporting LIKE on lower case metadata values
+static constexpr std::array<std::string_view, 2> postgresFullTextCreate {
+    R"(CREATE EXTENSION IF NOT EXISTS pg_trgm)",
+    R"(CREATE INDEX IF NOT EXISTS "grb_metadata_value_trgm" ON "mt_metadata" USING gin (LOWER("property_value") gin_trgm_ops))",
+};
+static constexpr std::array<std::string_view, 2> postgresClosureCreate {
+    R"(CREATE TABLE "grb_cds_closure"("ancestor_id" INTEGER NOT NULL, "descendant_id" INTEGER NOT NULL, PRIMARY KEY("ancestor_id", "descendant_id"), CONSTRAINT "grb_cds_closure_fk1" FOREIGN KEY("ancestor_id") REFERENCES "mt_cds_object"("id") ON DELETE CASCADE, CONSTRAINT "grb_cds_closure_fk2" FOREIGN KEY("descendant_id") REFERENCES "mt_cds_object"("id") ON DELETE CASCADE))",
+    R"(CREATE INDEX "grb_cds_closure_descendant" ON "grb_cds_closure"("descendant_id"))",
+};
+static constexpr auto postgresFullTextDrop = std::string_view(R"(DROP INDEX IF EXISTS "grb_metadata_value_trgm")");
 
 PostgresDatabase::PostgresDatabase(std::shared_ptr<Config> config,
     std::shared_ptr<Mime> mime,
@@ -137,6 +149,8 @@ void PostgresDatabase::init()
             log_info("Saving string limit {}", stringLimit);
             storeInternalSetting("string_limit", fmt::to_string(stringLimit));
         }
+        initFullText();
+        initContainerClosure({ postgresClosureCreate.begin(), postgresClosureCreate.end() });
         dbInitDone = true;
     } catch (const std::runtime_error& e) {
         log_error("Prematurely shutting down.\n{}", e.what());
@@ -153,6 +167,21 @@ void PostgresDatabase::init()
     }
 }
 
+void PostgresDatabase::initFullText()
+{
+    try {
+        if (!fullTextSearch) {
+            _exec(std::string(postgresFullTextDrop));
+            return;
+        }
+        for (auto&& stmt : postgresFullTextCreate)
+            _exec(std::string(stmt));
+        enableFullTextSearch(fmt::format("{}", identifier(METADATA_TABLE)), fmt::format("{}", identifier("id")), fmt::format("LOWER({})", identifier("property_value")));
+    } catch (const std::runtime_error& e) {
+        log_warning("Full-text search not available: {}", e.what());
+    }
+}
+
 void PostgresDatabase::dropTables()
 {
     auto file = config->getOption(ConfigVal::SERVER_STORAGE_PGSQL_DROP_FILE);
@@ -195,6 +224,7 @@ void PostgresDatabase::threadProc()
         conn->set_client_encoding("utf8");
         conn->set_notice_handler(handlePqxxNotice);
         StdThreadRunner::waitFor("PostgresDatabase", [this] { return threadRunner != nullptr; });
+        PGStatementCache statementCache(STATEMENT_CACHE_SIZE);
         auto lock = threadRunner->uniqueLockS("threadProc");
         // tell init() that we are ready
         threadRunner->setReady();
@@ -209,6 +239,7 @@ void PostgresDatabase::threadProc()
                 taskQueue.pop();
 
                 lock.unlock();
+                task->setStatementCache(&statementCache);
                 try {
                     task->run(conn, *this, throwOnError(task));
                     if (task->didContamination())
@@ -338,6 +369,20 @@ void PostgresDatabase::execOnly(const std::string& query)
     }
 }
 
+std::shared_ptr<SQLResult> PostgresDatabase::selectPrepared(const std::string& query, const std::vector<SQLParam>& params)
+{
+    try {
+        log_debug("Adding prepared select to Queue: {}", query);
+        auto stask = std::make_shared<PGPreparedSelectTask>(query, params);
+        addTask(stask);
+        stask->waitForTask();
+        return stask->getResult();
+    } catch (const std::exception& e) {
+        handleException(e, LINE_MESSAGE);
+        return {};
+    }
+}
+
 std::shared_ptr<SQLResult> PostgresDatabase::select(const std::string& query)
 {
     try {
@@ -63,14 +63,18 @@ protected:
     std::string getUnreferencedQuery(const std::string& table) override;
 
 private:
+    /// @brief create or remove trigram index depending on config
+    void initFullText();
     void run() override;
     void init() override;
     void shutdownDriver() override;
     std::shared_ptr<Database> getSelf() override;
 
     std::string quote(const std::string& value) const override;
+    bool nullsSortFirst() const override { return false; }
 
     std::shared_ptr<SQLResult> select(const std::string& query) override;
+    std::shared_ptr<SQLResult> selectPrepared(const std::string& query, const std::vector<SQLParam>& params) override;
     void del(std::string_view tableName, const std::string& clause, const std::vector<int>& ids) override;
     void execOnTable(std::string_view tableName, const std::string& query, int objId) override;
     int exec(const std::string& query, const std::string& getLastInsertId = "") override;
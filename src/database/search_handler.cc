@@ -647,6 +647,13 @@ std::string DefaultSQLEmitter::emit(const ASTStringOperator* node, const std::st
     if (logicOperator.find(stringOperator) == logicOperator.end()) {
         throw SearchParseException(fmt::format("Operation '{}' not yet supported", stringOperator), LINE_MESSAGE);
     }
+    if (fullText && (stringOperator == "contains" || stringOperator == "startswith") && value.size() >= fullText->minLength
+        && metaMapper && !(colMapper && colMapper->hasEntry(property)) && !(resMapper && resMapper->hasEntry(property)) && !(plyMapper && plyMapper->hasEntry(property))) {
+        // same metadata row as LIKE on the joined table, but found through the index
+        auto pattern = stringOperator == "contains" ? fmt::format("%{}%", value) : fmt::format("{}%", value);
+        return fmt::format("({}='{}' AND {} IN (SELECT {} FROM {} WHERE {} LIKE LOWER('{}')))",
+            metaMapper->mapQuoted(META_NAME), property, fullText->metaId, fullText->id, fullText->table, fullText->value, pattern);
+    }
     auto [prpUpper, prpLower, prpType] = getPropertyStatement(property);
     auto clsUpper = std::get<0>(getPropertyStatement(UPNP_SEARCH_CLASS));
     return fmt::format(logicOperator.at(stringOperator), clsUpper, prpUpper, prpLower, value, prpType);
@@ -376,6 +376,20 @@ struct SearchProperty {
     }
 };
 
+/// @brief index on metadata values that replaces LIKE for contains and startswith
+struct FullTextIndex {
+    /// @brief quoted id column of the metadata table in the search query
+    std::string metaId;
+    /// @brief quoted table that is searched
+    std::string table;
+    /// @brief column of table containing the metadata id
+    std::string id;
+    /// @brief expression on table that is compared with LIKE
+    std::string value;
+    /// @brief shorter values cannot use the index
+    std::size_t minLength { 3 };
+};
+
 class DefaultSQLEmitter : public SQLEmitter {
 public:
     DefaultSQLEmitter(std::shared_ptr<ColumnMapper> colMapper,
@@ -396,11 +410,15 @@ public:
     std::string emit(const ASTAndOperator* node, const std::string& lhs, const std::string& rhs) const override;
     std::string emit(const ASTOrOperator* node, const std::string& lhs, const std::string& rhs) const override;
 
+    /// @brief use index for string operators on metadata, must be set before searching
+    void setFullTextIndex(std::shared_ptr<FullTextIndex> fullText) { this->fullText = std::move(fullText); }
+
 private:
     std::shared_ptr<ColumnMapper> colMapper;
     std::shared_ptr<ColumnMapper> metaMapper;
     std::shared_ptr<ColumnMapper> resMapper;
     std::shared_ptr<ColumnMapper> plyMapper;
+    std::shared_ptr<FullTextIndex> fullText;
 
     std::tuple<std::string, std::string, FieldType> getPropertyStatement(const std::string& property) const;
 };
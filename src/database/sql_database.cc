@@ -57,10 +57,12 @@
 #include "util/url_utils.h"
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 #define MAX_REMOVE_SIZE 1000
 #define MAX_REMOVE_RECURSION 500
+#define MAX_INSERT_ROWS 500
 
 #define AUS_ALIAS "as"
 #define CFG_ALIAS "co"
@@ -338,6 +340,19 @@ SELECT {3}.* FROM {0} AS {1} JOIN {2} ON {1}.{6} = {3}.{5}
 -- Select desired cols from items
 SELECT {{}} FROM items AS {3})";
 
+// Format string for a query of a parent container using the closure table
+static constexpr auto sql_search_closure_query_raw = R"(
+-- Find all physical items below parent_id and de-reference any virtual item (i.e. follow ref-id)
+WITH items AS (SELECT {2}.* FROM {0} AS {1} JOIN {3} AS {2} ON {2}.{4} = {1}.{6} WHERE {1}.{5} = {{0}} AND {1}.{6} != {{0}} AND {2}.{7} IS NULL
+UNION
+SELECT {2}.* FROM {0} AS {1} JOIN {3} AS {8} ON {8}.{4} = {1}.{6} JOIN {3} AS {2} ON {8}.{7} = {2}.{4} WHERE {1}.{5} = {{0}} AND {1}.{6} != {{0}}
+)
+-- Select desired cols from items
+SELECT {{1}} FROM items AS {2})";
+
+/// @brief internal setting marking a filled closure table
+#define CLOSURE_SETTING "container_closure"
+
 #define getCol(rw, idx) (rw)->col(to_underlying((idx)))
 #define getColInt(rw, idx, def) (rw)->col_int(to_underlying((idx)), (def))
 #define setCol(dict, key, val, map) (dict).emplace((key), quote((val), (map).at((key)).length))
@@ -360,10 +375,22 @@ SQLDatabase::SQLDatabase(
     , mime(std::move(mime))
     , converterManager(std::move(converterManager))
     , stringLimit(this->config->getUIntOption(ConfigVal::SERVER_STORAGE_STRING_LIMIT))
+    , fullTextSearch(this->config->getBoolOption(ConfigVal::SERVER_STORAGE_FULLTEXT_SEARCH))
+    , containerClosure(this->config->getBoolOption(ConfigVal::SERVER_STORAGE_CONTAINER_CLOSURE))
     , dynamicContentList(this->config->getDynamicContentListOption(ConfigVal::SERVER_DYNAMIC_CONTENT_LIST))
     , dynamicContentEnabled(this->config->getBoolOption(ConfigVal::SERVER_DYNAMIC_CONTENT_LIST_ENABLED))
     , sortKeyEnabled(this->config->getBoolOption(ConfigVal::SERVER_STORAGE_SORT_KEY_ENABLED))
-{
+    , childCountCheck(this->config->getBoolOption(ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_CHECK))
+{
+    auto childCountCacheSize = this->config->getUIntOption(ConfigVal::SERVER_STORAGE_CHILD_COUNT_CACHE_SIZE);
+    if (childCountCacheSize > 0)
+        childCountCache = std::make_shared<ChildCountCache>(childCountCacheSize);
+    auto browseCursorCacheSize = this->config->getUIntOption(ConfigVal::SERVER_STORAGE_BROWSE_CURSOR_CACHE_SIZE);
+    if (browseCursorCacheSize > 0)
+        browseCursorCache = std::make_shared<BrowseCursorCache>(browseCursorCacheSize);
+    auto virtualPathCacheSize = this->config->getUIntOption(ConfigVal::SERVER_STORAGE_VIRTUAL_PATH_CACHE_SIZE);
+    if (virtualPathCacheSize > 0)
+        virtualPathCache = std::make_shared<VirtualPathCache>(virtualPathCacheSize);
     for (auto&& [key, val] : browseColMap) {
         if (val.type == FieldType::String && val.length > stringLimit)
             val.length = stringLimit;
@@ -468,6 +495,7 @@ void SQLDatabase::init()
             playstatusColumnMapper->mapQuoted(PlaystatusColumn::ItemId), browseColumnMapper->mapQuoted(BrowseColumn::Id));
         this->sql_browse_columns = fmt::format("{}", fmt::join(buf, ", "));
         this->sql_browse_query = fmt::format("{} {} {} ", browseColumnMapper->tableQuoted(), join1, join2);
+        this->sql_load_object_query = fmt::format("SELECT {} FROM {} WHERE {}", sql_browse_columns, sql_browse_query, browseColumnMapper->getClause(BrowseColumn::Id, "?"));
     }
     // Statement for UPnP search
     {
@@ -498,6 +526,17 @@ void SQLDatabase::init()
             searchColumnMapper->mapQuoted(UPNP_SEARCH_ID, true),
             searchColumnMapper->mapQuoted(UPNP_SEARCH_REFID, true));
         this->sql_search_container_query_format = fmt::format("{} {} {} {}", sql_container_query, join1, join2, join3);
+
+        // Build container query format string for closure table
+        auto sql_closure_query = fmt::format(sql_search_closure_query_raw,
+            identifier(CLOSURE_TABLE),
+            identifier("cl"), // defines an alias in in query_raw
+            searchColumnMapper->getAlias(), searchColumnMapper->getTableName(),
+            searchColumnMapper->mapQuoted(UPNP_SEARCH_ID, true),
+            identifier("ancestor_id"), identifier("descendant_id"),
+            searchColumnMapper->mapQuoted(UPNP_SEARCH_REFID, true),
+            identifier("cont")); // defines an alias in in query_raw
+        this->sql_search_closure_query_format = fmt::format("{} {} {} {}", sql_closure_query, join1, join2, join3);
     }
     // Statement for metadata
     {
@@ -531,6 +570,67 @@ void SQLDatabase::init()
     sqlEmitter = std::make_shared<DefaultSQLEmitter>(searchColumnMapper, metaColumnMapper, resourceColumnMapper, playstatusColumnMapper);
 }
 
+void SQLDatabase::enableFullTextSearch(const std::string& table, const std::string& id, const std::string& value)
+{
+    auto index = std::make_shared<FullTextIndex>();
+    index->metaId = fmt::format("{}.{}", identifier(MTA_ALIAS), identifier("id"));
+    index->table = table;
+    index->id = id;
+    index->value = value;
+    sqlEmitter->setFullTextIndex(std::move(index));
+    log_info("Using full-text index {} for search", table);
+}
+
+void SQLDatabase::initContainerClosure(const std::vector<std::string_view>& createCommands)
+{
+    try {
+        // setting lives in the same database, a new database starts without closure table
+        bool filled = getInternalSetting(CLOSURE_SETTING) == "1";
+        if (!containerClosure) {
+            if (filled) {
+                _exec(fmt::format("DROP TABLE IF EXISTS {}", identifier(CLOSURE_TABLE)));
+                storeInternalSetting(CLOSURE_SETTING, "0");
+            }
+            return;
+        }
+        if (filled)
+            return;
+
+        log_info("Building closure table of containers");
+        _exec(fmt::format("DROP TABLE IF EXISTS {}", identifier(CLOSURE_TABLE)));
+        for (auto&& cmd : createCommands)
+            _exec(std::string(cmd));
+        _exec(fmt::format("INSERT INTO {0} ({1}, {2}) "
+                          "WITH RECURSIVE {3} ({1}, {2}) AS (SELECT {4}, {4} FROM {5} "
+                          "UNION ALL SELECT {3}.{1}, {6}.{4} FROM {3} JOIN {5} AS {6} ON {6}.{7} = {3}.{2} AND {6}.{4} != {6}.{7}) "
+                          "SELECT {1}, {2} FROM {3}",
+            identifier(CLOSURE_TABLE), identifier("ancestor_id"), identifier("descendant_id"), identifier("tree"),
+            browseColumnMapper->mapQuoted(BrowseColumn::Id, true), browseColumnMapper->getTableName(), identifier("obj"),
+            browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true)));
+        storeInternalSetting(CLOSURE_SETTING, "1");
+    } catch (const std::runtime_error& e) {
+        log_warning("Closure table not available: {}", e.what());
+        containerClosure = false;
+    }
+}
+
+void SQLDatabase::addClosure(int objectId, int parentId)
+{
+    execOnly(fmt::format("INSERT INTO {0} ({1}, {2}) SELECT {1}, {3} FROM {0} WHERE {2} = {4} UNION ALL SELECT {3}, {3}",
+        identifier(CLOSURE_TABLE), identifier("ancestor_id"), identifier("descendant_id"), objectId, parentId));
+}
+
+void SQLDatabase::moveClosure(int objectId, int parentId)
+{
+    // remove old ancestors of the subtree, nested select is required by mysql
+    auto subTree = fmt::format("SELECT {0} FROM (SELECT {0} FROM {1} WHERE {2} = {3}) AS {4}",
+        identifier("descendant_id"), identifier(CLOSURE_TABLE), identifier("ancestor_id"), objectId, identifier("sub"));
+    execOnly(fmt::format("DELETE FROM {0} WHERE {1} IN ({3}) AND {2} NOT IN ({3})",
+        identifier(CLOSURE_TABLE), identifier("descendant_id"), identifier("ancestor_id"), subTree));
+    execOnly(fmt::format("INSERT INTO {0} ({1}, {2}) SELECT {3}.{1}, {4}.{2} FROM {0} AS {3} JOIN {0} AS {4} ON {4}.{1} = {5} WHERE {3}.{2} = {6}",
+        identifier(CLOSURE_TABLE), identifier("ancestor_id"), identifier("descendant_id"), identifier("par"), identifier("sub"), objectId, parentId));
+}
+
 static std::shared_ptr<CdsContainer> setDefaultContainer(
     const std::shared_ptr<BoxLayout>& bl,
     const std::string& defTitle)
@@ -655,6 +755,35 @@ std::string SQLDatabase::quote(const std::string& value, std::size_t len) const
     return quote(value);
 }
 
+std::string SQLDatabase::formatPrepared(const std::string& query, const std::vector<SQLParam>& params) const
+{
+    std::string result;
+    result.reserve(query.size() + params.size() * 8);
+    std::size_t index = 0;
+    bool inLiteral = false;
+    for (auto&& chr : query) {
+        if (chr == '\'')
+            inLiteral = !inLiteral;
+        if (chr != '?' || inLiteral) {
+            result.push_back(chr);
+            continue;
+        }
+        if (index >= params.size())
+            throw DatabaseException(fmt::format("Missing parameter {} for {}", index + 1, query), LINE_MESSAGE);
+        auto&& param = params.at(index++);
+        if (std::holds_alternative<long long>(param))
+            result.append(quote(std::get<long long>(param)));
+        else
+            result.append(quote(std::get<std::string>(param)));
+    }
+    return result;
+}
+
+std::shared_ptr<SQLResult> SQLDatabase::selectPrepared(const std::string& query, const std::vector<SQLParam>& params)
+{
+    return select(formatPrepared(query, params));
+}
+
 std::string SQLDatabase::getSearchCapabilities()
 {
     auto searchKeys = std::vector {
@@ -877,6 +1006,9 @@ void SQLDatabase::addObject(const std::shared_ptr<CdsObject>& obj, int* changedC
         throw DatabaseException("Tried to add an object with an object ID set", LINE_MESSAGE);
 
     auto tables = _addUpdateObject(obj, Operation::Insert, changedContainer);
+    ChildCountCache::Change countChange(childCountCache.get());
+    if (!tables.empty())
+        countChange.add(obj->getParentID(), obj->getObjectType(), 1);
 
     beginTransaction("addObject");
     for (auto&& addUpdateTable : tables) {
@@ -886,11 +1018,82 @@ void SQLDatabase::addObject(const std::shared_ptr<CdsObject>& obj, int* changedC
         if (!addUpdateTable->hasInsertResult().empty()) {
             int newId = exec(qb, addUpdateTable->hasInsertResult());
             obj->setID(newId);
+            if (containerClosure)
+                addClosure(newId, obj->getParentID());
         } else {
             execOnTable(CDS_OBJECT_TABLE, qb, obj->getID());
         }
     }
     commit("addObject");
+    countChange.apply();
+}
+
+void SQLDatabase::addObjects(const std::vector<std::shared_ptr<CdsObject>>& objects, int* changedContainer)
+{
+    if (objects.empty())
+        return;
+
+    std::vector<std::vector<std::shared_ptr<AddUpdateTable<CdsObject>>>> objectTables;
+    objectTables.reserve(objects.size());
+    ChildCountCache::Change countChange(childCountCache.get());
+    for (auto&& obj : objects) {
+        if (obj->getID() != INVALID_OBJECT_ID)
+            throw DatabaseException("Tried to add an object with an object ID set", LINE_MESSAGE);
+        objectTables.push_back(_addUpdateObject(obj, Operation::Insert, changedContainer));
+        if (!objectTables.back().empty())
+            countChange.add(obj->getParentID(), obj->getObjectType(), 1);
+    }
+
+    std::vector<std::map<MetadataColumn, std::string>> metadataRows;
+    std::vector<std::map<ResourceColumn, std::string>> resourceRows;
+    std::vector<std::map<ResourceAttribute, std::string>> resourceAttributes;
+
+    beginTransaction("addObjects");
+    for (std::size_t index = 0; index < objects.size(); index++) {
+        auto&& obj = objects.at(index);
+        for (auto&& addUpdateTable : objectTables.at(index)) {
+            if (!addUpdateTable->hasInsertResult().empty()) {
+                // object id is required for all following rows
+                auto qb = addUpdateTable->sqlForInsert(obj);
+                log_debug("Generated insert: {}", qb);
+                int newId = exec(qb, addUpdateTable->hasInsertResult());
+                obj->setID(newId);
+                if (containerClosure)
+                    addClosure(newId, obj->getParentID());
+            } else if (auto mt = std::dynamic_pointer_cast<Metadata2Table>(addUpdateTable)) {
+                auto row = mt->getRowData();
+                row[MetadataColumn::ItemId] = quote(obj->getID());
+                metadataRows.push_back(std::move(row));
+            } else if (auto rt = std::dynamic_pointer_cast<Resource2Table>(addUpdateTable)) {
+                auto row = rt->getRowData();
+                row[ResourceColumn::ItemId] = quote(obj->getID());
+                resourceRows.push_back(std::move(row));
+                resourceAttributes.push_back(rt->getResourceAttributes());
+            } else {
+                execOnTable(CDS_OBJECT_TABLE, addUpdateTable->sqlForInsert(obj), obj->getID());
+            }
+        }
+    }
+    // limit rows per statement to stay below SQLITE_MAX_SQL_LENGTH and max_allowed_packet
+    for (std::size_t start = 0; start < metadataRows.size(); start += MAX_INSERT_ROWS) {
+        auto end = std::min(start + MAX_INSERT_ROWS, metadataRows.size());
+        Metadata2Table mt({ std::make_move_iterator(metadataRows.begin() + start), std::make_move_iterator(metadataRows.begin() + end) }, metaColumnMapper);
+        auto qb = mt.sqlForMultiInsert(nullptr);
+        log_debug("Generated insert: {}", qb);
+        execOnTable(METADATA_TABLE, qb, INVALID_OBJECT_ID);
+    }
+    for (std::size_t start = 0; start < resourceRows.size(); start += MAX_INSERT_ROWS) {
+        auto end = std::min(start + MAX_INSERT_ROWS, resourceRows.size());
+        Resource2Table rt({ std::make_move_iterator(resourceRows.begin() + start), std::make_move_iterator(resourceRows.begin() + end) },
+            { std::make_move_iterator(resourceAttributes.begin() + start), std::make_move_iterator(resourceAttributes.begin() + end) },
+            resColumnMapper);
+        auto qb = rt.sqlForMultiInsert(nullptr);
+        log_debug("Generated insert: {}", qb);
+        execOnTable(RESOURCE_TABLE, qb, INVALID_OBJECT_ID);
+    }
+    commit("addObjects");
+    countChange.apply();
+    log_debug("Added {} objects", objects.size());
 }
 
 void SQLDatabase::updateObject(const std::shared_ptr<CdsObject>& obj, int* changedContainer)
@@ -910,6 +1113,28 @@ void SQLDatabase::updateObject(const std::shared_ptr<CdsObject>& obj, int* chang
         data = _addUpdateObject(obj, Operation::Update, changedContainer);
     }
 
+    ChildCountCache::Change countChange(childCountCache.get());
+    bool moved = false;
+    if ((childCountCache || containerClosure) && obj->getID() != CDS_ID_FS_ROOT && !data.empty()) {
+        // parent or type may change with the update
+        auto res = selectPrepared(fmt::format("SELECT {}, {} FROM {} WHERE {}",
+                                      browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
+                                      browseColumnMapper->mapQuoted(BrowseColumn::ObjectType, true),
+                                      browseColumnMapper->getTableName(),
+                                      browseColumnMapper->getClause(BrowseColumn::Id, "?", true)),
+            { obj->getID() });
+        std::unique_ptr<SQLRow> row;
+        if (res && (row = res->nextRow())) {
+            auto oldParentId = row->col_int(0, INVALID_OBJECT_ID);
+            auto oldObjectType = static_cast<unsigned int>(row->col_int(1, 0));
+            if (oldParentId != obj->getParentID() || oldObjectType != obj->getObjectType()) {
+                countChange.add(oldParentId, oldObjectType, -1);
+                countChange.add(obj->getParentID(), obj->getObjectType(), 1);
+            }
+            moved = oldParentId != obj->getParentID();
+        }
+    }
+
     beginTransaction("updateObject");
     for (auto&& addUpdateTable : data) {
         Operation op = addUpdateTable->getOperation();
@@ -939,7 +1164,16 @@ void SQLDatabase::updateObject(const std::shared_ptr<CdsObject>& obj, int* chang
             break;
         }
     }
+    if (moved && containerClosure)
+        moveClosure(obj->getID(), obj->getParentID());
     commit("updateObject");
+    countChange.apply();
+    if (virtualPathCache && obj->isContainer()) {
+        if (obj->getEntryType() == CdsEntryType::VirtualContainer && !obj->getLocation().empty())
+            virtualPathCache->set(obj->getLocation().string(), obj->getID());
+        else
+            virtualPathCache->erase(obj->getID());
+    }
 }
 
 std::shared_ptr<CdsObject> SQLDatabase::loadObject(
@@ -950,38 +1184,34 @@ std::shared_ptr<CdsObject> SQLDatabase::loadObject(
         return dynamicContainers.at(objectID);
     }
 
-    beginTransaction("loadObject");
-    auto loadSql = fmt::format("SELECT {} FROM {} WHERE {}",
-        sql_browse_columns,
-        sql_browse_query,
-        browseColumnMapper->getClause(BrowseColumn::Id, quote(objectID)));
-    auto res = select(loadSql);
+    beginReadTransaction("loadObject");
+    auto res = selectPrepared(sql_load_object_query, { objectID });
     if (res) {
         auto row = res->nextRow();
         if (row) {
             auto result = createObjectFromRow(group, row);
-            commit("loadObject");
+            commitRead("loadObject");
             return result;
         }
     }
-    log_debug("sql_query = {}", loadSql);
-    commit("loadObject");
+    log_debug("sql_query = {} with {}", sql_load_object_query, objectID);
+    commitRead("loadObject");
     throw ObjectNotFoundException(fmt::format("Object not found: {}", objectID));
 }
 
 std::shared_ptr<CdsObject> SQLDatabase::loadObjectByServiceID(const std::string& serviceID, const std::string& group)
 {
     auto loadSql = fmt::format("SELECT {} FROM {} WHERE {} = {}", sql_browse_columns, sql_browse_query, browseColumnMapper->mapQuoted(BrowseColumn::ServiceId), quote(serviceID));
-    beginTransaction("loadObjectByServiceID");
+    beginReadTransaction("loadObjectByServiceID");
     auto res = select(loadSql);
     if (res) {
         auto row = res->nextRow();
         if (row) {
-            commit("loadObjectByServiceID");
+            commitRead("loadObjectByServiceID");
             return createObjectFromRow(group, row);
         }
     }
-    commit("loadObjectByServiceID");
+    commitRead("loadObjectByServiceID");
 
     return {};
 }
@@ -1008,9 +1238,9 @@ std::vector<int> SQLDatabase::getServiceObjectIDs(char servicePrefix)
         browseColumnMapper->getTableName(),
         browseColumnMapper->mapQuoted(BrowseColumn::ServiceId, true), quote(std::string(1, servicePrefix) + WILDCARD));
 
-    beginTransaction("getServiceObjectIDs");
+    beginReadTransaction("getServiceObjectIDs");
     auto res = select(getSql);
-    commit("getServiceObjectIDs");
+    commitRead("getServiceObjectIDs");
     if (!res)
         throw DatabaseException(fmt::format("error selecting from {}", CDS_OBJECT_TABLE), LINE_MESSAGE);
 
@@ -1053,10 +1283,14 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
     bool hideFsRoot = param.getFlag(BROWSE_HIDE_FS_ROOT);
     int childCount = 1;
     std::vector<std::string> where;
+    std::vector<SQLParam> params;
     std::string orderBy;
     std::string limit;
     std::string addColumns;
     std::string addJoin;
+    // continue paging behind the last row of the previous request
+    std::string cursorKey;
+    bool cursorUsed = false;
 
     if (param.getSources().size() > 0) {
         where.push_back(fmt::format("{} IN ({})",
@@ -1073,7 +1307,8 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
         childCount = childCounts.empty() ? 0 : childCounts.at(parent->getID());
         param.setTotalMatches(childCount);
 
-        where.push_back(fmt::format("{} = {}", browseColumnMapper->mapQuoted(BrowseColumn::ParentId), parent->getID()));
+        where.push_back(browseColumnMapper->getClause(BrowseColumn::ParentId, "?"));
+        params.emplace_back(parent->getID());
 
         if (parent->getID() == CDS_ID_ROOT && hideFsRoot)
             where.push_back(fmt::format("{} != {:d}", browseColumnMapper->mapQuoted(BrowseColumn::Id), CDS_ID_FS_ROOT));
@@ -1081,13 +1316,16 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
         if (getItems && !forbiddenDirectories.empty()) {
             std::vector<std::string> forbiddenList;
             for (auto&& forbDir : forbiddenDirectories) {
-                forbiddenList.push_back(fmt::format("({0} is not null AND {0} like {1})", browseColumnMapper->mapQuoted(BrowseColumn::RefLocation), quote(forbDir + WILDCARD)));
-                forbiddenList.push_back(fmt::format("({0} is not null AND {0} like {1})", browseColumnMapper->mapQuoted(BrowseColumn::Location), quote(forbDir + WILDCARD)));
+                forbiddenList.push_back(fmt::format("({0} is not null AND {0} like ?)", browseColumnMapper->mapQuoted(BrowseColumn::RefLocation)));
+                forbiddenList.push_back(fmt::format("({0} is not null AND {0} like ?)", browseColumnMapper->mapQuoted(BrowseColumn::Location)));
+                params.emplace_back(forbDir + WILDCARD);
+                params.emplace_back(forbDir + WILDCARD);
             }
             where.push_back(fmt::format("(NOT (({0} & {1}) = {1} AND ({2})) OR ({0} & {1}) != {1})", browseColumnMapper->mapQuoted(BrowseColumn::ObjectType), OBJECT_TYPE_ITEM, fmt::join(forbiddenList, " OR ")));
         }
 
         // order by code..
+        bool defaultSort = false;
         auto orderByCode = [&]() {
             std::string orderQb;
             if (param.getFlag(BROWSE_TRACK_SORT)) {
@@ -1097,21 +1335,23 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
                 orderQb = sortParser.parse(addColumns, addJoin);
             }
             if (orderQb.empty()) {
-                if (sortKeyEnabled)
-                    orderQb = browseColumnMapper->mapQuoted(BrowseColumn::SortKey);
-                else
-                    orderQb = browseColumnMapper->mapQuoted(BrowseColumn::DcTitle);
+                defaultSort = true;
+                orderQb = browseColumnMapper->mapQuoted(sortKeyEnabled ? BrowseColumn::SortKey : BrowseColumn::DcTitle);
             }
             return orderQb;
         };
 
-        auto limitCode = [](int startingIndex, int requestedCount) {
+        auto limitCode = [&params](int startingIndex, int requestedCount) {
             if (startingIndex > 0 && requestedCount > 0) {
-                return fmt::format(" LIMIT {} OFFSET {}", requestedCount, startingIndex);
+                params.emplace_back(requestedCount);
+                params.emplace_back(startingIndex);
+                return std::string(" LIMIT ? OFFSET ?");
             } else if (startingIndex > 0) {
-                return fmt::format(" LIMIT ~0 OFFSET {}", startingIndex);
+                params.emplace_back(startingIndex);
+                return std::string(" LIMIT ~0 OFFSET ?");
             } else if (requestedCount > 0) {
-                return fmt::format(" LIMIT {}", requestedCount);
+                params.emplace_back(requestedCount);
+                return std::string(" LIMIT ?");
             }
             return std::string();
         };
@@ -1135,30 +1375,68 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
                 browseColumnMapper->mapQuoted(BrowseColumn::UpnpClass), orderByCode());
         }
 
-        limit = limitCode(param.getStartingIndex(), param.getRequestedCount());
+        // keyset paging requires a unique order which can be compared with the last row
+        if (browseCursorCache && defaultSort && !param.getSession().empty() && param.getRequestedCount() > 0 && (getContainers || getItems)) {
+            auto container = std::dynamic_pointer_cast<CdsContainer>(parent);
+            cursorKey = fmt::format("{}|{}|{}|{}|{}|{}", param.getSession(), param.getGroup(), parent->getID(), container ? container->getUpdateID() : 0, param.getFlag(~0U), param.getSortCriteria());
+            orderBy.append(fmt::format(", {}", browseColumnMapper->mapQuoted(BrowseColumn::Id)));
+
+            auto cursor = param.getStartingIndex() > 0 ? browseCursorCache->get(cursorKey, param.getStartingIndex()) : std::nullopt;
+            if (cursor) {
+                std::vector<std::pair<std::string, std::optional<SQLParam>>> columns;
+                if (getContainers)
+                    columns.emplace_back(browseColumnMapper->mapQuoted(BrowseColumn::UpnpClass), cursor->upnpClass);
+                columns.emplace_back(browseColumnMapper->mapQuoted(sortKeyEnabled ? BrowseColumn::SortKey : BrowseColumn::DcTitle), cursor->sortValue);
+                columns.emplace_back(browseColumnMapper->mapQuoted(BrowseColumn::Id), cursor->id);
+                auto objectType = browseColumnMapper->mapQuoted(BrowseColumn::ObjectType);
+                if (!getContainers || !getItems)
+                    where.push_back(seekClause(columns, params));
+                else if (cursor->objectType == OBJECT_TYPE_CONTAINER) // containers are sorted before items
+                    where.push_back(fmt::format("({0} != {1} OR ({0} = {1} AND {2}))", objectType, OBJECT_TYPE_CONTAINER, seekClause(columns, params)));
+                else
+                    where.push_back(fmt::format("({0} != {1} AND {2})", objectType, OBJECT_TYPE_CONTAINER, seekClause(columns, params)));
+                cursorUsed = true;
+                log_debug("browse {} continues at {} behind {}", parent->getID(), param.getStartingIndex(), cursor->id);
+            }
+        }
+
+        limit = limitCode(cursorUsed ? 0 : param.getStartingIndex(), param.getRequestedCount());
     } else { // metadata
         param.setTotalMatches(1);
-        where.push_back(fmt::format("{} = {}", browseColumnMapper->mapQuoted(BrowseColumn::Id), parent->getID()));
+        where.push_back(browseColumnMapper->getClause(BrowseColumn::Id, "?"));
+        params.emplace_back(parent->getID());
         limit = " LIMIT 1";
     }
 
     auto qb = fmt::format("SELECT {} {} FROM {} {} WHERE {}{}{}", sql_browse_columns, addColumns, sql_browse_query, addJoin, fmt::join(where, " AND "), orderBy, limit);
     log_debug("QUERY: {}", qb);
-    beginTransaction("browse");
-    std::shared_ptr<SQLResult> sqlResult = select(qb);
-    commit("browse");
+    beginReadTransaction("browse");
+    std::shared_ptr<SQLResult> sqlResult = selectPrepared(qb, params);
+    commitRead("browse");
 
     std::vector<std::shared_ptr<CdsObject>> result;
     std::vector<std::shared_ptr<CdsContainer>> containers;
     result.reserve(sqlResult->getNumRows());
     std::unique_ptr<SQLRow> row;
+    BrowseCursor lastRow;
+    auto optionalCol = [](const std::unique_ptr<SQLRow>& row, BrowseColumn column) {
+        auto value = row->col_c_str(to_underlying(column));
+        return value ? std::optional<std::string>(value) : std::nullopt;
+    };
     while ((row = sqlResult->nextRow())) {
         auto obj = createObjectFromRow(param.getGroup(), row);
+        if (!cursorKey.empty()) {
+            lastRow.objectType = obj->getObjectType();
+            lastRow.upnpClass = optionalCol(row, BrowseColumn::UpnpClass);
+            lastRow.sortValue = optionalCol(row, sortKeyEnabled ? BrowseColumn::SortKey : BrowseColumn::DcTitle);
+            lastRow.id = obj->getID();
+        }
         if (obj->isContainer()) {
             containers.push_back(std::static_pointer_cast<CdsContainer>(obj));
         }
         result.push_back(std::move(obj));
     }
+    const auto rowCount = result.size();
 
     // update childCount fields of containers (query all containers in one batch)
     if (!containers.empty()) {
@@ -1191,9 +1469,57 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::browse(BrowseParam& param)
     } else if (param.getSources().size() > 0) {
         param.setTotalMatches(result.size());
     }
+
+    // remember last row if the client can request a further page
+    if (!cursorKey.empty() && rowCount == result.size() && rowCount == static_cast<std::size_t>(param.getRequestedCount())) {
+        browseCursorCache->set(cursorKey, param.getStartingIndex() + static_cast<int>(rowCount), lastRow);
+    }
     return result;
 }
 
+std::string SQLDatabase::seekClause(
+    const std::vector<std::pair<std::string, std::optional<SQLParam>>>& columns,
+    std::vector<SQLParam>& params) const
+{
+    bool hasNull = std::any_of(columns.begin(), columns.end(), [](auto&& column) { return !column.second; });
+    if (!hasNull && nullsSortFirst()) {
+        std::vector<std::string> names;
+        for (auto&& [column, value] : columns) {
+            names.push_back(column);
+            params.push_back(*value);
+        }
+        return fmt::format("(({}) > ({}))", fmt::join(names, ", "), fmt::join(std::vector<std::string>(columns.size(), "?"), ", "));
+    }
+
+    // expand (c1, ..., cn) > (v1, ..., vn) to respect the position of NULL values
+    std::vector<std::string> alternatives;
+    std::vector<std::string> equal;
+    std::vector<SQLParam> equalParams;
+    for (auto&& [column, value] : columns) {
+        std::string greater;
+        if (value)
+            greater = nullsSortFirst() ? fmt::format("{} > ?", column) : fmt::format("({0} > ? OR {0} IS NULL)", column);
+        else if (nullsSortFirst())
+            greater = fmt::format("{} IS NOT NULL", column);
+
+        if (!greater.empty()) {
+            auto terms = equal;
+            terms.push_back(std::move(greater));
+            alternatives.push_back(fmt::format("({})", fmt::join(terms, " AND ")));
+            params.insert(params.end(), equalParams.begin(), equalParams.end());
+            if (value)
+                params.push_back(*value);
+        }
+        if (value) {
+            equal.push_back(fmt::format("{} = ?", column));
+            equalParams.push_back(*value);
+        } else {
+            equal.push_back(fmt::format("{} IS NULL", column));
+        }
+    }
+    return fmt::format("({})", fmt::join(alternatives, " OR "));
+}
+
 void SQLDatabase::initDynContainers(const std::shared_ptr<CdsObject>& sParent)
 {
     if (dynamicContentEnabled && dynamicContentList && dynamicContainers.size() < dynamicContentList->size()) {
@@ -1283,16 +1609,16 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::search(SearchParam& param)
         // Use faster, non-recursive search for root container
         countSQL = fmt::format("SELECT COUNT(DISTINCT {}) FROM {} WHERE {}", searchColumnMapper->mapQuoted(UPNP_SEARCH_ID), sql_search_query, searchSQL);
     } else {
-        // Use recursive container search
+        // Use closure table or recursive container search
         const std::string countSelect = fmt::format("COUNT(DISTINCT {})", searchColumnMapper->mapQuoted(UPNP_SEARCH_ID));
-        countSQL = fmt::format(sql_search_container_query_format, param.getContainerID(), countSelect);
+        countSQL = fmt::format(containerClosure ? sql_search_closure_query_format : sql_search_container_query_format, param.getContainerID(), countSelect);
         countSQL += fmt::format(" WHERE {}", searchSQL);
     }
 
     log_debug("Search count resolves to SQL [\n{}\n]", countSQL);
-    beginTransaction("search");
+    beginReadTransaction("search");
     auto sqlResult = select(countSQL);
-    commit("search");
+    commitRead("search");
 
     auto countRow = sqlResult->nextRow();
     if (countRow) {
@@ -1337,16 +1663,16 @@ std::vector<std::shared_ptr<CdsObject>> SQLDatabase::search(SearchParam& param)
         // Use faster, non-recursive search for root container
         retrievalSQL = fmt::format("SELECT DISTINCT {} {} FROM {} {} WHERE {}{}{}", sql_search_columns, addColumns, sql_search_query, addJoin, searchSQL, orderBy, limit);
     } else {
-        // Use recursive container search
+        // Use closure table or recursive container search
         const std::string retrievalSelect = fmt::format("DISTINCT {} {}", sql_search_columns, addColumns);
-        retrievalSQL = fmt::format(sql_search_container_query_format, param.getContainerID(), retrievalSelect);
+        retrievalSQL = fmt::format(containerClosure ? sql_search_closure_query_format : sql_search_container_query_format, param.getContainerID(), retrievalSelect);
         retrievalSQL += fmt::format(" {} WHERE {}{}{}", addJoin, searchSQL, orderBy, limit);
     }
 
     log_debug("Search statement resolves to SQL [\n{}\n]", retrievalSQL);
-    beginTransaction("search 2");
+    beginReadTransaction("search 2");
     sqlResult = select(retrievalSQL);
-    commit("search 2");
+    commitRead("search 2");
 
     std::vector<std::shared_ptr<CdsObject>> result;
     result.reserve(sqlResult->getNumRows());
@@ -1367,6 +1693,92 @@ std::map<int, int> SQLDatabase::getChildCounts(
     bool containers,
     bool items,
     bool hideFsRoot)
+{
+    if (!childCountCache || (hideFsRoot && std::find(contId.begin(), contId.end(), CDS_ID_ROOT) != contId.end()))
+        return _getChildCounts(contId, containers, items, hideFsRoot);
+
+    std::map<int, int> result;
+    if ((!containers && !items) || contId.empty())
+        return result;
+
+    std::vector<int> cached;
+    std::vector<int> missing;
+    for (auto&& id : contId) {
+        int count = 0;
+        if (childCountCache->get(id, containers, items, count)) {
+            cached.push_back(id);
+            if (count > 0)
+                result.emplace(id, count);
+        } else {
+            missing.push_back(id);
+        }
+    }
+
+    if (childCountCheck && !cached.empty()) {
+        auto dbCounts = _getChildCounts(cached, containers, items, false);
+        for (auto&& id : cached) {
+            auto cacheCount = result.find(id) != result.end() ? result.at(id) : 0;
+            auto dbCount = dbCounts.find(id) != dbCounts.end() ? dbCounts.at(id) : 0;
+            if (cacheCount != dbCount) {
+                log_error("Child count cache of container {} is {} but database has {}", id, cacheCount, dbCount);
+                childCountCache->erase(id);
+                result.erase(id);
+                if (dbCount > 0)
+                    result.emplace(id, dbCount);
+            }
+        }
+    }
+
+    if (!missing.empty()) {
+        auto counts = fillChildCountCache(missing);
+        for (auto&& [id, entry] : counts) {
+            auto count = entry.get(containers, items);
+            if (count > 0)
+                result.emplace(id, count);
+        }
+    }
+    return result;
+}
+
+std::map<int, ChildCountCache::Counts> SQLDatabase::fillChildCountCache(const std::vector<int>& contId)
+{
+    auto objectType = browseColumnMapper->mapQuoted(BrowseColumn::ObjectType, true);
+    std::vector<SQLParam> params(contId.begin(), contId.end());
+    auto generation = childCountCache->getGeneration();
+    beginReadTransaction("fillChildCountCache");
+    auto res = selectPrepared(fmt::format("SELECT {0}, COUNT(*), SUM(CASE WHEN {1} = {2} THEN 1 ELSE 0 END), SUM(CASE WHEN ({1} & {3}) = {3} THEN 1 ELSE 0 END) FROM {4} WHERE {0} IN ({5}) GROUP BY {0}",
+                                  browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
+                                  objectType,
+                                  OBJECT_TYPE_CONTAINER,
+                                  OBJECT_TYPE_ITEM,
+                                  browseColumnMapper->getTableName(),
+                                  fmt::join(std::vector<std::string>(contId.size(), "?"), ",")),
+        params);
+    commitRead("fillChildCountCache");
+
+    // containers without children are cached as well
+    std::map<int, ChildCountCache::Counts> result;
+    for (auto&& id : contId)
+        result.emplace(id, ChildCountCache::Counts());
+    if (res) {
+        std::unique_ptr<SQLRow> row;
+        while ((row = res->nextRow())) {
+            auto& entry = result[row->col_int(0, INVALID_OBJECT_ID)];
+            entry.total = row->col_int(1, 0);
+            entry.containers = row->col_int(2, 0);
+            entry.items = row->col_int(3, 0);
+        }
+    }
+    for (auto&& [id, entry] : result)
+        childCountCache->set(id, entry, generation);
+    return result;
+}
+
+std::map<int, int> SQLDatabase::_getChildCounts(
+    const std::vector<int>& contId,
+    bool containers,
+    bool items,
+    bool hideFsRoot)
 {
     std::map<int, int> result;
     if (!containers && !items)
@@ -1375,8 +1787,9 @@ std::map<int, int> SQLDatabase::getChildCounts(
     if (contId.empty())
         return result;
 
+    std::vector<SQLParam> params(contId.begin(), contId.end());
     auto where = std::vector {
-        fmt::format("{} IN ({})", browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true), fmt::join(contId, ","))
+        fmt::format("{} IN ({})", browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true), fmt::join(std::vector<std::string>(contId.size(), "?"), ","))
     };
     if (containers && !items)
         where.push_back(browseColumnMapper->getClause(BrowseColumn::ObjectType, OBJECT_TYPE_CONTAINER, true));
@@ -1386,12 +1799,13 @@ std::map<int, int> SQLDatabase::getChildCounts(
         where.push_back(fmt::format("{} != {:d}", browseColumnMapper->mapQuoted(BrowseColumn::Id, true), CDS_ID_FS_ROOT));
     }
 
-    beginTransaction("getChildCounts");
-    auto res = select(fmt::format("SELECT {0}, COUNT(*) FROM {1} WHERE {2} GROUP BY {0} ORDER BY {0}",
-        browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
-        browseColumnMapper->getTableName(),
-        fmt::join(where, " AND ")));
-    commit("getChildCounts");
+    beginReadTransaction("getChildCounts");
+    auto res = selectPrepared(fmt::format("SELECT {0}, COUNT(*) FROM {1} WHERE {2} GROUP BY {0} ORDER BY {0}",
+                                  browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
+                                  browseColumnMapper->getTableName(),
+                                  fmt::join(where, " AND ")),
+        params);
+    commitRead("getChildCounts");
 
     if (res) {
         std::unique_ptr<SQLRow> row;
@@ -1404,11 +1818,11 @@ std::map<int, int> SQLDatabase::getChildCounts(
 
 std::vector<std::string> SQLDatabase::getMimeTypes()
 {
-    beginTransaction("getMimeTypes");
+    beginReadTransaction("getMimeTypes");
     auto res = select(fmt::format("SELECT DISTINCT {0} FROM {1} WHERE {0} IS NOT NULL ORDER BY {0}",
         browseColumnMapper->mapQuoted(BrowseColumn::MimeType, true),
         browseColumnMapper->getTableName()));
-    commit("getMimeTypes");
+    commitRead("getMimeTypes");
 
     if (!res)
         throw DatabaseException(fmt::format("error selecting from {}", CDS_OBJECT_TABLE), LINE_MESSAGE);
@@ -1453,6 +1867,20 @@ std::shared_ptr<CdsObject> SQLDatabase::findObjectByPath(
     const std::string& group,
     DbFileType fileType)
 {
+    if (fileType == DbFileType::Virtual && virtualPathCache) {
+        auto cachedId = getVirtualPathId(fullpath.string());
+        if (cachedId && *cachedId == INVALID_OBJECT_ID)
+            return nullptr;
+        if (cachedId) {
+            try {
+                return loadObject(*cachedId, group);
+            } catch (const ObjectNotFoundException&) {
+                // removed while looking it up
+                virtualPathCache->erase(*cachedId);
+            }
+        }
+    }
+
     std::vector<int> et;
     switch (fileType) {
     case DbFileType::Auto:
@@ -1492,17 +1920,21 @@ std::shared_ptr<CdsObject> SQLDatabase::findObjectByPath(
         };
         break;
     }
+    auto params = std::vector<SQLParam> {
+        static_cast<long long>(stringHash(fullpath.c_str())),
+        fullpath.string(),
+    };
     auto where = std::vector {
-        browseColumnMapper->getClause(BrowseColumn::LocationHash, quote(stringHash(fullpath.c_str()))),
-        browseColumnMapper->getClause(BrowseColumn::Location, quote(fullpath)),
+        browseColumnMapper->getClause(BrowseColumn::LocationHash, "?"),
+        browseColumnMapper->getClause(BrowseColumn::Location, "?"),
     };
     where.push_back(fmt::format("{} IN ({})", browseColumnMapper->mapQuoted(BrowseColumn::EntryType), fmt::join(et, ",")));
 
     auto countSQL = fmt::format("SELECT COUNT(*) FROM {} WHERE {}", sql_browse_query, fmt::join(where, " AND "));
 
-    beginTransaction("countFind");
-    auto sqlResult = select(countSQL);
-    commit("countFind");
+    beginReadTransaction("countFind");
+    auto sqlResult = selectPrepared(countSQL, params);
+    commitRead("countFind");
 
     auto countRow = sqlResult->nextRow();
     if (countRow && countRow->col_int(0, 0) > 1) {
@@ -1511,24 +1943,109 @@ std::shared_ptr<CdsObject> SQLDatabase::findObjectByPath(
 
     auto findSql = fmt::format("SELECT {} FROM {} WHERE {} LIMIT 1", sql_browse_columns, sql_browse_query, fmt::join(where, " AND "));
 
-    beginTransaction("findObjectByPath");
-    auto res = select(findSql);
+    beginReadTransaction("findObjectByPath");
+    auto res = selectPrepared(findSql, params);
     log_debug("{} -> res={} ({})", findSql, !!res, res ? res->getNumRows() : -1);
     if (!res) {
-        commit("findObjectByPath");
+        commitRead("findObjectByPath");
         throw DatabaseException(fmt::format("error while doing select: {}", findSql), LINE_MESSAGE);
     }
     auto row = res->nextRow();
     if (row) {
         auto result = createObjectFromRow(group, row);
-        commit("findObjectByPath");
+        commitRead("findObjectByPath");
         return result;
     }
 
-    commit("findObjectByPath");
+    commitRead("findObjectByPath");
     return nullptr;
 }
 
+std::vector<std::pair<fs::path, DbPathEntry>> SQLDatabase::getPathEntries(const fs::path& path)
+{
+    auto root = path.string();
+    if (!root.empty() && root.back() == DIR_SEPARATOR)
+        root.pop_back();
+    auto params = std::vector<SQLParam> {
+        root,
+        root + DIR_SEPARATOR + WILDCARD,
+    };
+    auto columns = std::vector {
+        browseColumnMapper->mapQuoted(BrowseColumn::Id, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::ObjectType, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::EntryType, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::UpnpClass, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::LastModified, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::Location, true),
+        browseColumnMapper->mapQuoted(BrowseColumn::RefId, true),
+    };
+    auto location = browseColumnMapper->mapQuoted(BrowseColumn::Location, true);
+    auto query = fmt::format("SELECT {} FROM {} WHERE {} IN ({:d},{:d}) AND ({} = ? OR {} LIKE ?)",
+        fmt::join(columns, ","), browseColumnMapper->getTableName(),
+        browseColumnMapper->mapQuoted(BrowseColumn::EntryType, true), int(CdsEntryType::File), int(CdsEntryType::Directory),
+        location, location);
+
+    beginReadTransaction("getPathEntries");
+    auto res = selectPrepared(query, params);
+    commitRead("getPathEntries");
+    if (!res)
+        throw DatabaseException(fmt::format("error while doing select: {}", query), LINE_MESSAGE);
+
+    std::vector<std::pair<fs::path, DbPathEntry>> result;
+    result.reserve(res->getNumRows());
+    // LIKE may ignore case and treats _ as wildcard, so the prefix is checked again
+    auto prefix = root + DIR_SEPARATOR;
+    std::unique_ptr<SQLRow> row;
+    while ((row = res->nextRow())) {
+        auto rowLocation = row->col(6);
+        if (rowLocation != root && !startswith(rowLocation, prefix))
+            continue;
+        result.emplace_back(rowLocation,
+            DbPathEntry {
+                row->col_int(0, INVALID_OBJECT_ID),
+                row->col_int(1, INVALID_OBJECT_ID),
+                row->col_int(7, INVALID_OBJECT_ID),
+                static_cast<unsigned int>(row->col_int(2, 0)),
+                CdsEntryType(row->col_int(3, 0)),
+                row->col(4),
+                std::chrono::seconds(row->col_long(5, 0)),
+            });
+    }
+    return result;
+}
+
+std::optional<int> SQLDatabase::getVirtualPathId(const std::string& location)
+{
+    if (!virtualPathCache->isLoaded()) {
+        AutoLock lock(virtualPathMutex);
+        if (!virtualPathCache->isLoaded()) {
+            auto generation = virtualPathCache->getGeneration();
+            auto query = fmt::format("SELECT {}, {}, {} FROM {} WHERE {} AND {} IS NOT NULL",
+                browseColumnMapper->mapQuoted(BrowseColumn::Id, true),
+                browseColumnMapper->mapQuoted(BrowseColumn::Location, true),
+                browseColumnMapper->mapQuoted(BrowseColumn::RefId, true),
+                browseColumnMapper->getTableName(),
+                browseColumnMapper->getClause(BrowseColumn::EntryType, quote(int(CdsEntryType::VirtualContainer)), true),
+                browseColumnMapper->mapQuoted(BrowseColumn::Location, true));
+            beginTransaction("getVirtualPathId");
+            auto res = select(query);
+            commit("getVirtualPathId");
+            if (!res)
+                throw DatabaseException(fmt::format("error while doing select: {}", query), LINE_MESSAGE);
+
+            std::vector<VirtualPathCache::Entry> entries;
+            entries.reserve(res->getNumRows());
+            std::unique_ptr<SQLRow> row;
+            while ((row = res->nextRow())) {
+                entries.push_back({ row->col(1), row->col_int(0, INVALID_OBJECT_ID), row->col_int(2, INVALID_OBJECT_ID) != INVALID_OBJECT_ID });
+            }
+            virtualPathCache->load(entries, generation);
+        }
+    }
+    return virtualPathCache->get(location);
+}
+
 int SQLDatabase::ensurePathExistence(const fs::path& path, int* changedContainer)
 {
     if (changedContainer)
@@ -1590,10 +2107,15 @@ int SQLDatabase::createContainer(
         { BrowseColumn::EntryType, quote(int(isVirtual ? CdsEntryType::VirtualContainer : CdsEntryType::Directory)) },
         { BrowseColumn::RefId, (refID > CDS_ID_ROOT) ? quote(refID) : SQL_NULL },
     };
+    ChildCountCache::Change countChange(childCountCache.get());
+    countChange.add(parentID, OBJECT_TYPE_CONTAINER, 1);
+
     beginTransaction("createContainer");
     Object2Table ot(std::move(dict), Operation::Insert, browseColumnMapper);
     int newId = exec(ot.sqlForInsert(nullptr), browseColumnMapper->mapQuoted(BrowseColumn::Id, true)); // get last id#
     log_debug("Created object row, id: {}", newId);
+    if (containerClosure)
+        addClosure(newId, parentID);
 
     const std::string newIdStr = quote(newId);
     if (!itemMetadata.empty()) {
@@ -1640,6 +2162,7 @@ int SQLDatabase::createContainer(
         log_debug("Wrote resources for cds_object {}", newId);
     }
     commit("createContainer");
+    countChange.apply();
 
     return newId;
 }
@@ -1647,6 +2170,8 @@ int SQLDatabase::createContainer(
 void SQLDatabase::deleteAll(std::string_view tableName)
 {
     del(tableName, "", {});
+    if (childCountCache && tableName == CDS_OBJECT_TABLE)
+        childCountCache->clear();
 }
 
 void SQLDatabase::deleteRows(std::string_view tableName, const std::string& key, const std::vector<int>& values)
@@ -1654,18 +2179,30 @@ void SQLDatabase::deleteRows(std::string_view tableName, const std::string& key,
     del(tableName, fmt::format("{} IN ({})", identifier(key), fmt::join(values, ",")), values);
 }
 
+bool SQLDatabase::hasVirtualContainer(int objectID, const std::string& virtualPath)
+{
+    auto where = std::vector {
+        browseColumnMapper->getClause(BrowseColumn::Id, objectID, true),
+        browseColumnMapper->getClause(BrowseColumn::LocationHash, quote(stringHash(virtualPath)), true),
+    };
+    beginReadTransaction("hasVirtualContainer");
+    auto res = select(fmt::format("SELECT 1 FROM {} WHERE {} LIMIT 1", browseColumnMapper->getTableName(), fmt::join(where, " AND ")));
+    commitRead("hasVirtualContainer");
+    return res && res->nextRow();
+}
+
 fs::path SQLDatabase::buildContainerPath(int parentID, const std::string& title)
 {
     if (parentID == CDS_ID_ROOT)
         return title;
 
-    beginTransaction("buildContainerPath");
+    beginReadTransaction("buildContainerPath");
     auto res = select(fmt::format("SELECT {}, {} FROM {} WHERE {} LIMIT 1",
         browseColumnMapper->mapQuoted(BrowseColumn::Location, true),
         browseColumnMapper->mapQuoted(BrowseColumn::EntryType, true),
         browseColumnMapper->getTableName(),
         browseColumnMapper->getClause(BrowseColumn::Id, parentID, true)));
-    commit("buildContainerPath");
+    commitRead("buildContainerPath");
     if (!res)
         return {};
 
@@ -1699,28 +2236,53 @@ bool SQLDatabase::addContainer(
         return false;
     }
 
-    beginTransaction("addContainer");
-    auto where = std::vector {
-        browseColumnMapper->getClause(BrowseColumn::EntryType, quote(int(cont->getEntryType())), true),
-        browseColumnMapper->getClause(BrowseColumn::Location, quote(virtualPath), true),
-        browseColumnMapper->getClause(BrowseColumn::LocationHash, quote(stringHash(virtualPath)), true),
-    };
-    auto res = select(fmt::format("SELECT {} FROM {} WHERE {} LIMIT 1",
-        browseColumnMapper->mapQuoted(BrowseColumn::Id, true),
-        browseColumnMapper->getTableName(),
-        fmt::join(where, " AND ")));
-    if (res) {
-        auto row = res->nextRow();
-        if (row) {
-            if (containerID) {
-                *containerID = row->col_int(0, INVALID_OBJECT_ID);
-                log_debug("Found container for path: {}, lastRefId: {} -> containerId: {}", virtualPath.c_str(), cont->getRefID(), *containerID);
-            }
-            commit("addContainer");
+    // the cache can only answer for containers that are stored as virtual container
+    auto useCache = virtualPathCache && cont->isVirtual() && cont->getEntryType() == CdsEntryType::VirtualContainer;
+    if (useCache)
+        getVirtualPathId(virtualPath); // load before lock
+    std::unique_lock<std::mutex> cacheLock(virtualPathMutex, std::defer_lock);
+    if (useCache) {
+        cacheLock.lock();
+        auto cachedId = virtualPathCache->get(virtualPath);
+        if (cachedId && *cachedId != INVALID_OBJECT_ID && !hasVirtualContainer(*cachedId, virtualPath)) {
+            // removed without _removeObjects, e.g. by cascade or reset of tables, so other entries are stale, too
+            log_debug("Cached container {} for path {} is gone, reloading cache", *cachedId, virtualPath);
+            virtualPathCache->clear();
+            cachedId = std::nullopt;
+        }
+        if (cachedId && *cachedId != INVALID_OBJECT_ID) {
+            if (containerID)
+                *containerID = *cachedId;
+            log_debug("Found cached container for path: {} -> containerId: {}", virtualPath, *cachedId);
             return false;
         }
+        useCache = cachedId.has_value();
+    }
+
+    if (!useCache) {
+        beginTransaction("addContainer");
+        auto where = std::vector {
+            browseColumnMapper->getClause(BrowseColumn::EntryType, quote(int(cont->getEntryType())), true),
+            browseColumnMapper->getClause(BrowseColumn::Location, quote(virtualPath), true),
+            browseColumnMapper->getClause(BrowseColumn::LocationHash, quote(stringHash(virtualPath)), true),
+        };
+        auto res = select(fmt::format("SELECT {} FROM {} WHERE {} LIMIT 1",
+            browseColumnMapper->mapQuoted(BrowseColumn::Id, true),
+            browseColumnMapper->getTableName(),
+            fmt::join(where, " AND ")));
+        if (res) {
+            auto row = res->nextRow();
+            if (row) {
+                if (containerID) {
+                    *containerID = row->col_int(0, INVALID_OBJECT_ID);
+                    log_debug("Found container for path: {}, lastRefId: {} -> containerId: {}", virtualPath.c_str(), cont->getRefID(), *containerID);
+                }
+                commit("addContainer");
+                return false;
+            }
+        }
+        commit("addContainer");
     }
-    commit("addContainer");
 
     if (cont->getMetaData(MetadataFields::M_DATE).empty())
         cont->addMetaData(MetadataFields::M_DATE, grbLocaltime("{:%FT%T%z}", cont->getMTime()));
@@ -1729,6 +2291,8 @@ bool SQLDatabase::addContainer(
         cont->getTitle(), virtualPath, cont->getFlags(), cont->isVirtual(), cont->getClass(),
         cont->hasFlag(ObjectFlag::PlaylistReference) ? cont->getRefID() : INVALID_OBJECT_ID,
         cont->getSource(), cont->getMetaData(), cont->getResources());
+    if (virtualPathCache && cont->isVirtual())
+        virtualPathCache->set(virtualPath, *containerID);
     return true;
 }
 
@@ -2209,9 +2773,34 @@ void SQLDatabase::_removeObjects(const std::vector<std::int32_t>& objectIDs)
         }
     }
 
+    ChildCountCache::Change countChange(childCountCache.get());
+    if (childCountCache) {
+        auto countSql = fmt::format("SELECT {0}, {1}, COUNT(*) FROM {2} WHERE {3} IN ({4}) GROUP BY {0}, {1}",
+            browseColumnMapper->mapQuoted(BrowseColumn::ParentId, true),
+            browseColumnMapper->mapQuoted(BrowseColumn::ObjectType, true),
+            browseColumnMapper->getTableName(),
+            browseColumnMapper->mapQuoted(BrowseColumn::Id, true),
+            fmt::join(objectIDs, ","));
+        auto countRes = select(countSql);
+        std::unique_ptr<SQLRow> row;
+        while (countRes && (row = countRes->nextRow())) {
+            countChange.add(row->col_int(0, INVALID_OBJECT_ID), static_cast<unsigned int>(row->col_int(1, 0)), -row->col_int(2, 0));
+        }
+    }
+
     deleteRows(CDS_OBJECT_TABLE, "id", objectIDs);
     del(RESOURCE_TABLE, fmt::format("{} IN ('{}')", identifier(EnumMapper::getAttributeName(ResourceAttribute::FANART_OBJ_ID)), fmt::join(objectIDs, "','")), objectIDs);
     commit("_removeObjects");
+
+    if (childCountCache) {
+        countChange.apply();
+        for (auto&& id : objectIDs)
+            childCountCache->erase(id);
+    }
+    if (virtualPathCache) {
+        for (auto&& id : objectIDs)
+            virtualPathCache->erase(id);
+    }
 }
 
 std::unique_ptr<Database::ChangedContainers> SQLDatabase::removeObject(int objectID, const fs::path& path, bool all)
@@ -36,8 +36,12 @@
 
 #include "config/config.h"
 #include "config/config_val.h"
+#include "browse_cursor.h"
+#include "child_count_cache.h"
 #include "database.h"
 #include "sql_format.h"
+#include "sql_result.h"
+#include "virtual_path_cache.h"
 
 #include <array>
 #include <mutex>
@@ -49,7 +53,7 @@ template <class Item>
 class AddUpdateTable;
 class CdsContainer;
 class CdsResource;
-class SQLEmitter;
+class DefaultSQLEmitter;
 class SQLResult;
 class SQLRow;
 template <class Col>
@@ -87,14 +91,28 @@ public:
     virtual void beginTransaction(std::string_view tName) { }
     virtual void rollback(std::string_view tName) { }
     virtual void commit(std::string_view tName) { }
+    /// @brief transaction that only reads, backends may run its selects without blocking writers
+    virtual void beginReadTransaction(std::string_view tName) { beginTransaction(tName); }
+    virtual void commitRead(std::string_view tName) { commit(tName); }
 
     virtual void del(std::string_view tableName, const std::string& clause, const std::vector<int>& ids) = 0;
     virtual void execOnTable(std::string_view tableName, const std::string& query, int objId) = 0;
     virtual int exec(const std::string& query, const std::string& getLastInsertId = "") = 0;
     virtual void execOnly(const std::string& query) = 0;
     virtual std::shared_ptr<SQLResult> select(const std::string& query) = 0;
+    /// @brief run select with ? as placeholders for params
+    /// drivers with prepared statements bind the params, the default formats them into the query
+    virtual std::shared_ptr<SQLResult> selectPrepared(const std::string& query, const std::vector<SQLParam>& params);
+    /// @brief replace placeholders outside of literals by quoted params
+    std::string formatPrepared(const std::string& query, const std::vector<SQLParam>& params) const;
+    /// @brief NULL values are sorted before other values in ascending order
+    virtual bool nullsSortFirst() const { return true; }
+    /// @brief build condition for rows sorted behind the values of the last row
+    /// @param columns sort columns with value of the last row, the last column has to be unique
+    std::string seekClause(const std::vector<std::pair<std::string, std::optional<SQLParam>>>& columns, std::vector<SQLParam>& params) const;
 
     void addObject(const std::shared_ptr<CdsObject>& obj, int* changedContainer) override;
+    void addObjects(const std::vector<std::shared_ptr<CdsObject>>& objects, int* changedContainer) override;
     void updateObject(const std::shared_ptr<CdsObject>& obj, int* changedContainer) override;
 
     std::shared_ptr<CdsObject> loadObject(
@@ -138,6 +156,7 @@ public:
         const fs::path& fullpath,
         const std::string& group,
         DbFileType fileType = DbFileType::Auto) override;
+    std::vector<std::pair<fs::path, DbPathEntry>> getPathEntries(const fs::path& path) override;
     std::string incrementUpdateIDs(const std::unordered_set<int>& ids) override;
 
     fs::path buildContainerPath(int parentID, const std::string& title) override;
@@ -207,6 +226,10 @@ protected:
     std::size_t firstDBVersion = 1;
     /// @brief Maximum length designated as GRBMAX in ddl statement
     unsigned int stringLimit;
+    /// @brief Is the full-text index on metadata enabled in config
+    bool fullTextSearch;
+    /// @brief Is the closure table of containers enabled in config
+    bool containerClosure;
     /// @brief lock for special sql commands
     mutable std::recursive_mutex sqlMutex;
     using SqlAutoLock = std::scoped_lock<decltype(sqlMutex)>;
@@ -223,6 +246,14 @@ protected:
     void initDynContainers(const std::shared_ptr<CdsObject>& sParent = {});
     /// @brief create core entries in fresh database
     void fillDatabase();
+    /// @brief let search find metadata values through an index
+    /// @param table table or index containing the metadata ids
+    /// @param id column of table with the metadata id
+    /// @param value expression on table that supports LIKE with the index
+    void enableFullTextSearch(const std::string& table, const std::string& id, const std::string& value);
+    /// @brief create and fill or remove the closure table depending on config
+    /// @param createCommands statements creating the empty table with indexes in the dialect of the driver
+    void initContainerClosure(const std::vector<std::string_view>& createCommands);
 
     /// @brief upgrade database version by applying migration commands
     void upgradeDatabase(
@@ -241,8 +272,10 @@ protected:
 private:
     std::string sql_browse_columns;
     std::string sql_browse_query;
+    std::string sql_load_object_query;
     std::string sql_search_columns;
     std::string sql_search_container_query_format;
+    std::string sql_search_closure_query_format;
     std::string sql_search_query;
     std::string sql_meta_query;
     std::string sql_autoscan_query;
@@ -254,6 +287,26 @@ private:
     bool dynamicContentEnabled;
     /// @brief Is sorting by sort_key enabled in config
     bool sortKeyEnabled;
+    /// @brief Counts of children per container, nullptr if disabled
+    std::shared_ptr<ChildCountCache> childCountCache;
+    /// @brief Compare cached child counts with database
+    bool childCountCheck;
+    /// @brief Position of clients paging through containers, nullptr if disabled
+    std::shared_ptr<BrowseCursorCache> browseCursorCache;
+    /// @brief Ids of virtual containers by location, nullptr if disabled
+    std::shared_ptr<VirtualPathCache> virtualPathCache;
+    /// @brief keep check and insert of virtual containers together while the cache is used
+    std::mutex virtualPathMutex;
+
+    /// @brief read child counts of containers from database
+    std::map<int, int> _getChildCounts(const std::vector<int>& contId, bool containers, bool items, bool hideFsRoot);
+    /// @brief read child counts of containers from database and store them in cache
+    std::map<int, ChildCountCache::Counts> fillChildCountCache(const std::vector<int>& contId);
+    /// @brief get id of virtual container from cache, read all virtual containers on first use
+    /// @return id, INVALID_OBJECT_ID if there is no such container, std::nullopt if the database has to be asked
+    std::optional<int> getVirtualPathId(const std::string& location);
+    /// @brief check that cached virtual container still exists
+    bool hasVirtualContainer(int objectID, const std::string& virtualPath);
 
     std::shared_ptr<CdsObject> createObjectFromRow(const std::string& group, const std::unique_ptr<SQLRow>& row);
     std::shared_ptr<CdsObject> createObjectFromSearchRow(const std::string& group, const std::unique_ptr<SQLRow>& row);
@@ -274,6 +327,11 @@ private:
         Operation op,
         std::vector<std::shared_ptr<AddUpdateTable<CdsObject>>>& operations);
 
+    /// @brief add rows of new object below parent to closure table
+    void addClosure(int objectId, int parentId);
+    /// @brief replace ancestors of moved object and its descendants in closure table
+    void moveClosure(int objectId, int parentId);
+
     /* helper for removeObject(s) */
     void _removeObjects(const std::vector<std::int32_t>& objectIDs);
 
@@ -306,7 +364,7 @@ private:
     static bool remapBool(const std::string& field) { return field == "1"; }
     static bool remapBool(int field) { return field == 1; }
 
-    std::shared_ptr<SQLEmitter> sqlEmitter;
+    std::shared_ptr<DefaultSQLEmitter> sqlEmitter;
 
     using AutoLock = std::scoped_lock<std::mutex>;
     friend class SQLMigration;
@@ -26,6 +26,10 @@
 
 #include <memory>
 #include <string>
+#include <variant>
+
+/// @brief value bound to a placeholder of a prepared select
+using SQLParam = std::variant<long long, std::string>;
 
 class SQLRow {
 public:
@@ -31,6 +31,8 @@
 #include "upnp/clients.h"
 #include "util/grb_net.h"
 
+#include <set>
+
 const std::vector<BrowseColumn> Object2Table::tableColumnOrder = {
     BrowseColumn::Id,
     BrowseColumn::RefId,
@@ -201,6 +203,48 @@ std::string Resource2Table::sqlForInsert(
         fmt::join(values, ", "));
 }
 
+std::string Resource2Table::sqlForMultiInsert(
+    const std::shared_ptr<CdsObject>& obj) const
+{
+    // attribute columns used by any of the rows
+    std::set<ResourceAttribute> attributes;
+    for (auto&& attrs : resMultiDict) {
+        for (auto&& [key, val] : attrs) {
+            attributes.insert(key);
+        }
+    }
+
+    std::vector<std::string> fields;
+    fields.reserve(getTableColumnOrder().size() + attributes.size());
+    for (auto&& field : getTableColumnOrder()) {
+        fields.push_back(columnMapper->mapQuoted(field, true));
+    }
+    for (auto&& key : attributes) {
+        fields.push_back(columnMapper->quote(EnumMapper::getAttributeName(key)));
+    }
+
+    std::vector<std::string> tuples;
+    tuples.reserve(rowMultiData.size());
+    for (std::size_t index = 0; index < rowMultiData.size(); index++) {
+        auto&& row = rowMultiData.at(index);
+        std::vector<std::string> values;
+        values.reserve(fields.size());
+        for (auto&& field : getTableColumnOrder()) {
+            values.push_back(row.find(field) != row.end() ? row.at(field) : SQL_NULL);
+        }
+        for (auto&& key : attributes) {
+            auto&& attrs = resMultiDict.at(index);
+            values.push_back(attrs.find(key) != attrs.end() ? attrs.at(key) : SQL_NULL);
+        }
+        tuples.push_back(fmt::format("({})", fmt::join(values, ",")));
+    }
+
+    return fmt::format("INSERT INTO {} ({}) VALUES {}",
+        columnMapper->getTableName(),
+        fmt::join(fields, ", "),
+        fmt::join(tuples, ", "));
+}
+
 std::string Resource2Table::sqlForUpdate(
     const std::shared_ptr<CdsObject>& obj) const
 {
@@ -49,6 +49,7 @@ enum class ResourceAttribute;
 #define AUTOSCAN_TABLE "mt_autoscan"
 #define CLIENTS_TABLE "grb_client"
 #define CDS_OBJECT_TABLE "mt_cds_object"
+#define CLOSURE_TABLE "grb_cds_closure"
 #define CONFIG_VALUE_TABLE "grb_config_value"
 #define METADATA_TABLE "mt_metadata"
 #define PLAYSTATUS_TABLE "grb_playstatus"
@@ -248,6 +249,9 @@ public:
     virtual std::string sqlForUpdateAll(const std::map<Tab, std::string>& whereDict) const;
     virtual std::string sqlForDeleteAll(const std::map<Tab, std::string>& whereDict) const;
 
+    /// @brief get row content to combine several operations into one statement
+    const std::map<Tab, std::string>& getRowData() const { return rowData; }
+
 protected:
     /// @brief content to store in request
     std::map<Tab, std::string> rowData;
@@ -334,11 +338,24 @@ public:
         , resDict(std::move(resDict))
     {
     }
+    Resource2Table(
+        std::vector<std::map<ResourceColumn, std::string>>&& dict,
+        std::vector<std::map<ResourceAttribute, std::string>>&& resDict,
+        std::shared_ptr<EnumColumnMapper<ResourceColumn>> columnMapper) noexcept
+        : TableAdaptor(RESOURCE_TABLE, std::move(dict), std::move(columnMapper))
+        , resMultiDict(std::move(resDict))
+    {
+    }
     std::string sqlForInsert(
         const std::shared_ptr<CdsObject>& obj) const override;
+    std::string sqlForMultiInsert(
+        const std::shared_ptr<CdsObject>& obj) const override;
     std::string sqlForUpdate(
         const std::shared_ptr<CdsObject>& obj) const override;
 
+    /// @brief get attribute content to combine several operations into one statement
+    const std::map<ResourceAttribute, std::string>& getResourceAttributes() const { return resDict; }
+
 protected:
     const std::vector<ResourceColumn>& getTableColumnOrder() const override
     {
@@ -350,6 +367,8 @@ protected:
 private:
     static const std::vector<ResourceColumn> tableColumnOrder;
     std::map<ResourceAttribute, std::string> resDict;
+    /// @brief attributes for each row of rowMultiData
+    std::vector<std::map<ResourceAttribute, std::string>> resMultiDict;
 };
 
 /// @brief Adaptor for operations on mt_autoscan Table
@@ -26,6 +26,8 @@
 
 #include "database/sql_result.h"
 
+#include <vector>
+
 /// @brief Represents a result of a sqlite3 select
 class Sqlite3Result : public SQLResult {
 public:
@@ -47,7 +49,12 @@ private:
     int nrow;
     int ncolumn;
 
+    /// @brief cell values of a prepared select, cellTable has the layout of table
+    std::vector<std::string> cellData;
+    std::vector<char*> cellTable;
+
     friend class SLSelectTask;
+    friend class SLPreparedSelectTask;
 };
 
 /// @brief Represents a row of a result of a sqlite3 select
@@ -34,6 +34,50 @@
 
 #include <utility>
 
+/* SLStatementCache */
+
+sqlite3_stmt* SLStatementCache::get(sqlite3* db, const std::string& query)
+{
+    if (db != connection) {
+        clear();
+        connection = db;
+    }
+
+    auto entry = statements.find(query);
+    if (entry != statements.end()) {
+        usage.splice(usage.begin(), usage, entry->second.second);
+        sqlite3_reset(entry->second.first);
+        sqlite3_clear_bindings(entry->second.first);
+        return entry->second.first;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, query.c_str(), static_cast<int>(query.size()), &stmt, nullptr) != SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        return nullptr;
+    }
+    if (statements.size() >= maxSize && !usage.empty()) {
+        auto last = statements.find(usage.back());
+        sqlite3_finalize(last->second.first);
+        statements.erase(last);
+        usage.pop_back();
+    }
+    usage.push_front(query);
+    statements.emplace(query, std::make_pair(stmt, usage.begin()));
+    return stmt;
+}
+
+void SLStatementCache::clear()
+{
+    for (auto&& [query, entry] : statements) {
+        sqlite3_finalize(entry.first);
+    }
+    statements.clear();
+    usage.clear();
+}
+
+/* SLTask */
+
 SLTask::~SLTask() = default;
 
 bool SLTask::is_running() const
@@ -94,6 +138,8 @@ void SLScriptTask::run(sqlite3*& db, Sqlite3Database& sl, bool throwOnError)
     log_debug("Running: init");
     std::string dbFilePath = config->getOption(ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE);
 
+    if (statementCache)
+        statementCache->clear();
     sqlite3_close(db);
 
     int res = sqlite3_open(dbFilePath.c_str(), &db);
@@ -163,6 +209,77 @@ void SLSelectTask::run(sqlite3*& db, Sqlite3Database& sl, bool throwOnError)
     pres->cur_row = 0;
 }
 
+/* SLPreparedSelectTask */
+SLPreparedSelectTask::SLPreparedSelectTask(const std::string& query, std::vector<SQLParam> params)
+    : SLSelectTask(query)
+    , params(std::move(params))
+{
+}
+
+void SLPreparedSelectTask::run(sqlite3*& db, Sqlite3Database& sl, bool throwOnError)
+{
+    log_debug("Running: {} with {} parameter(s)", query, params.size());
+    pres = std::make_shared<Sqlite3Result>();
+
+    // statements of connections without cache are used once
+    std::unique_ptr<sqlite3_stmt, int (*)(sqlite3_stmt*)> ownStmt(nullptr, sqlite3_finalize);
+    sqlite3_stmt* stmt = nullptr;
+    if (statementCache) {
+        stmt = statementCache->get(db, query);
+    } else if (sqlite3_prepare_v2(db, query, -1, &stmt, nullptr) == SQLITE_OK) {
+        ownStmt.reset(stmt);
+    } else {
+        sqlite3_finalize(stmt);
+        stmt = nullptr;
+    }
+    if (!stmt) {
+        throw DatabaseException("", sl.handleError(query, "prepare failed", db, sqlite3_errcode(db)));
+    }
+
+    for (std::size_t index = 0; index < params.size(); index++) {
+        auto&& param = params.at(index);
+        int ret;
+        if (std::holds_alternative<long long>(param)) {
+            ret = sqlite3_bind_int64(stmt, index + 1, std::get<long long>(param));
+        } else {
+            auto&& text = std::get<std::string>(param);
+            ret = sqlite3_bind_text(stmt, index + 1, text.c_str(), static_cast<int>(text.size()), SQLITE_STATIC);
+        }
+        if (ret != SQLITE_OK) {
+            throw DatabaseException("", sl.handleError(query, "bind failed", db, ret));
+        }
+    }
+
+    pres->ncolumn = sqlite3_column_count(stmt);
+    pres->nrow = 0;
+    std::vector<bool> isNull;
+    int ret;
+    while ((ret = sqlite3_step(stmt)) == SQLITE_ROW) {
+        for (int col = 0; col < pres->ncolumn; col++) {
+            auto text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+            isNull.push_back(!text);
+            pres->cellData.emplace_back(text ? text : "");
+        }
+        pres->nrow++;
+    }
+    std::string error = ret != SQLITE_DONE ? sqlite3_errmsg(db) : "";
+    // keep statement usable, but drop bound text and read locks
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    if (ret != SQLITE_DONE) {
+        throw DatabaseException("", sl.handleError(query, error, db, ret));
+    }
+
+    // same layout as sqlite3_get_table: first row is the header
+    pres->cellTable.assign(pres->ncolumn, nullptr);
+    pres->cellTable.reserve(pres->cellData.size() + pres->ncolumn);
+    for (std::size_t index = 0; index < pres->cellData.size(); index++) {
+        pres->cellTable.push_back(isNull.at(index) ? nullptr : pres->cellData.at(index).data());
+    }
+    pres->row = pres->cellTable.data();
+    pres->cur_row = 0;
+}
+
 /* SLExecTask */
 
 SLExecTask::SLExecTask(const std::string& query, std::string getLastInsertId, bool warnOnly)
@@ -230,6 +347,8 @@ void SLBackupTask::run(sqlite3*& db, Sqlite3Database& sl, bool throwOnError)
         }
     } else {
         log_info("trying to restore sqlite3 database from backup...");
+        if (statementCache)
+            statementCache->clear();
         sqlite3_close(db);
         try {
             fs::copy(
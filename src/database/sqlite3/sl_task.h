@@ -24,10 +24,15 @@
 #ifndef __SQLITE3_TASK_H__
 #define __SQLITE3_TASK_H__
 
+#include "database/sql_result.h"
 #include "util/grb_fs.h"
 
+#include <chrono>
 #include <condition_variable>
+#include <list>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 class Config;
 enum class ConfigVal;
@@ -36,11 +41,40 @@ class Sqlite3Result;
 
 extern "C" {
 struct sqlite3;
+struct sqlite3_stmt;
 }
 
 #define SQLITE3_BACKUP_FORMAT "{}.backup"
 #define SQLITE3_SET_VERSION "INSERT INTO \"mt_internal_setting\" VALUES('db_version', '{}')"
 
+/// @brief Prepared statements of one connection, least recently used are finalized first
+class SLStatementCache {
+public:
+    explicit SLStatementCache(std::size_t maxSize)
+        : maxSize(maxSize)
+    {
+    }
+    ~SLStatementCache() { clear(); }
+
+    SLStatementCache(const SLStatementCache&) = delete;
+    SLStatementCache& operator=(const SLStatementCache&) = delete;
+
+    /// @brief get reset statement for query, prepare it if not cached yet
+    /// @return nullptr if query cannot be prepared
+    sqlite3_stmt* get(sqlite3* db, const std::string& query);
+    /// @brief finalize all statements, required before connection is closed
+    void clear();
+
+    std::size_t size() const { return statements.size(); }
+
+private:
+    std::size_t maxSize;
+    sqlite3* connection {};
+    /// @brief queries in order of usage, most recent first
+    std::list<std::string> usage;
+    std::unordered_map<std::string, std::pair<sqlite3_stmt*, std::list<std::string>::iterator>> statements;
+};
+
 /// @brief A virtual class that represents a task to be done by the sqlite3 thread.
 class SLTask {
 public:
@@ -78,6 +112,15 @@ public:
 
     virtual bool checkKey(const std::string& key) const { return true; }
 
+    /// @brief set statement cache of the connection running the task
+    void setStatementCache(SLStatementCache* cache) { statementCache = cache; }
+
+    /// @brief time since the task was created, i.e. waiting in queue before run
+    std::chrono::microseconds getAge() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - created);
+    }
+
 protected:
     /// @brief true as long as the task is not finished
     ///
@@ -95,6 +138,8 @@ protected:
     mutable std::mutex mutex;
 
     std::string error;
+    std::chrono::steady_clock::time_point created { std::chrono::steady_clock::now() };
+    SLStatementCache* statementCache {};
 };
 
 /// @brief A task for the sqlite3 thread to inititally create the database.
@@ -137,6 +182,22 @@ protected:
     std::shared_ptr<Sqlite3Result> pres;
 };
 
+/// @brief A task for the sqlite3 thread to do a SQL select with a prepared statement.
+class SLPreparedSelectTask : public SLSelectTask {
+public:
+    /// @brief Constructor for the sqlite3 prepared select task
+    /// @param query The SQL query string with ? as placeholders
+    /// @param params The values for the placeholders
+    SLPreparedSelectTask(const std::string& query, std::vector<SQLParam> params);
+
+    void run(sqlite3*& db, Sqlite3Database& sl, bool throwOnError = true) override;
+
+    std::string_view taskType() const override { return "PreparedSelectTask"; }
+
+protected:
+    std::vector<SQLParam> params;
+};
+
 /// @brief A task for the sqlite3 thread to do a SQL exec.
 class SLExecTask : public SLTask {
 public:
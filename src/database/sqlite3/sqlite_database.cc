@@ -40,6 +40,7 @@
 #include "exceptions.h"
 #include "sl_result.h"
 #include "sl_task.h"
+#include "util/tools.h"
 
 #include <sqlite3.h>
 
@@ -49,8 +50,31 @@ static const auto sqlite3AddResourceAttr = std::map<ResourceDataType, std::strin
     { ResourceDataType::Number, R"(ALTER TABLE "grb_cds_resource" ADD COLUMN "{}" bigint default NULL)" }
 };
 
+/// @brief trigram index on metadata values, kept in sync with mt_metadata by triggers
+static constexpr auto sqlite3FullTextTable = std::string_view("grb_metadata_fts");
+static constexpr std::array<std::string_view, 5> sqlite3FullTextCreate {
+    R"(CREATE VIRTUAL TABLE "grb_metadata_fts" USING fts5("property_value", content='mt_metadata', content_rowid='id', tokenize='trigram'))",
+    R"(CREATE TRIGGER "grb_metadata_fts_insert" AFTER INSERT ON "mt_metadata" BEGIN INSERT INTO "grb_metadata_fts"(rowid, "property_value") VALUES (new."id", new."property_value"); END)",
+    R"(CREATE TRIGGER "grb_metadata_fts_delete" AFTER DELETE ON "mt_metadata" BEGIN INSERT INTO "grb_metadata_fts"("grb_metadata_fts", rowid, "property_value") VALUES ('delete', old."id", old."property_value"); END)",
+    R"(CREATE TRIGGER "grb_metadata_fts_update" AFTER UPDATE ON "mt_metadata" BEGIN INSERT INTO "grb_metadata_fts"("grb_metadata_fts", rowid, "property_value") VALUES ('delete', old."id", old."property_value"); INSERT INTO "grb_metadata_fts"(rowid, "property_value") VALUES (new."id", new."property_value"); END)",
+    R"(INSERT INTO "grb_metadata_fts"("grb_metadata_fts") VALUES ('rebuild'))",
+};
+static constexpr std::array<std::string_view, 4> sqlite3FullTextDrop {
+    R"(DROP TRIGGER IF EXISTS "grb_metadata_fts_insert")",
+    R"(DROP TRIGGER IF EXISTS "grb_metadata_fts_delete")",
+    R"(DROP TRIGGER IF EXISTS "grb_metadata_fts_update")",
+    R"(DROP TABLE IF EXISTS "grb_metadata_fts")",
+};
+static constexpr std::array<std::string_view, 2> sqlite3ClosureCreate {
+    R"(CREATE TABLE "grb_cds_closure"("ancestor_id" integer NOT NULL, "descendant_id" integer NOT NULL, PRIMARY KEY("ancestor_id", "descendant_id"), CONSTRAINT "grb_cds_closure_fk1" FOREIGN KEY("ancestor_id") REFERENCES "mt_cds_object"("id") ON DELETE CASCADE, CONSTRAINT "grb_cds_closure_fk2" FOREIGN KEY("descendant_id") REFERENCES "mt_cds_object"("id") ON DELETE CASCADE) WITHOUT ROWID)",
+    R"(CREATE INDEX "grb_cds_closure_descendant" ON "grb_cds_closure"("descendant_id"))",
+};
+#define SQLITE3_FULLTEXT_MIN_VERSION 3034000 // trigram tokenizer
+
 #define DELETE_CACHE_MAX_TIME 60 // drop cache if last delete was more than 60 secs ago
 #define DELETE_CACHE_RED_SIZE 0.2 // reduce cache to 80% of max entries
+#define READ_BUSY_TIMEOUT 5000 // ms to wait for a lock on read connections
+#define STATEMENT_CACHE_SIZE 64 // prepared statements kept per connection
 
 Sqlite3Database::Sqlite3Database(const std::shared_ptr<Config>& config, const std::shared_ptr<Mime>& mime, const std::shared_ptr<ConverterManager>& converterManager, std::shared_ptr<Timer> timer)
     : SQLDatabase(config, mime, converterManager)
@@ -58,6 +82,11 @@ Sqlite3Database::Sqlite3Database(const std::shared_ptr<Config>& config, const st
     , shutdownAttempts(this->config->getIntOption(ConfigVal::SERVER_STORAGE_SQLITE_SHUTDOWN_ATTEMPTS))
 {
     dbFilePath = config->getOption(ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE);
+    readPoolSize = config->getIntOption(ConfigVal::SERVER_STORAGE_SQLITE_READ_POOL_SIZE);
+    if (readPoolSize > 0 && toLower(config->getOption(ConfigVal::SERVER_STORAGE_SQLITE_JOURNALMODE)) != "wal") {
+        log_warning("SQLite3 read connections require journal-mode WAL, running all queries on one connection");
+        readPoolSize = 0;
+    }
     table_quote_begin = '"';
     table_quote_end = '"';
 
@@ -73,7 +102,8 @@ Sqlite3Database::Sqlite3Database(const std::shared_ptr<Config>& config, const st
 
 void Sqlite3Database::prepare()
 {
-    _exec("PRAGMA locking_mode = EXCLUSIVE");
+    // read connections cannot share an exclusively locked database
+    _exec(readPoolSize > 0 ? "PRAGMA locking_mode = NORMAL" : "PRAGMA locking_mode = EXCLUSIVE");
     _exec("PRAGMA foreign_keys = ON");
     _exec(fmt::format("PRAGMA journal_mode = {}", config->getOption(ConfigVal::SERVER_STORAGE_SQLITE_JOURNALMODE)));
     exec(fmt::format("PRAGMA synchronous = {}", config->getIntOption(ConfigVal::SERVER_STORAGE_SQLITE_SYNCHRONOUS)));
@@ -234,6 +264,8 @@ void Sqlite3Database::init()
             log_info("Saving string limit {}", stringLimit);
             storeInternalSetting("string_limit", fmt::to_string(stringLimit));
         }
+        initFullText();
+        initContainerClosure({ sqlite3ClosureCreate.begin(), sqlite3ClosureCreate.end() });
         dbInitDone = true;
     } catch (const std::runtime_error& e) {
         log_error("Prematurely shutting down.");
@@ -248,6 +280,61 @@ void Sqlite3Database::init()
         shutdown();
         throw_std_runtime_error(e.what());
     }
+
+    startReadPool();
+}
+
+void Sqlite3Database::initFullText()
+{
+    if (fullTextSearch && sqlite3_libversion_number() < SQLITE3_FULLTEXT_MIN_VERSION) {
+        log_warning("Full-text search requires sqlite3 3.34, found {}", sqlite3_libversion());
+        fullTextSearch = false;
+    }
+    try {
+        // triggers are dropped with mt_metadata, then the index has to be rebuilt
+        auto res = select(fmt::format(R"(SELECT COUNT(*) FROM "sqlite_master" WHERE "type" = 'trigger' AND "tbl_name" = 'mt_metadata' AND "name" LIKE '{}%')", sqlite3FullTextTable));
+        auto row = res ? res->nextRow() : nullptr;
+        bool ready = row && row->col_int(0, 0) == 3;
+        if (!fullTextSearch || !ready) {
+            for (auto&& stmt : sqlite3FullTextDrop)
+                _exec(std::string(stmt));
+        }
+        if (!fullTextSearch)
+            return;
+        if (!ready) {
+            log_info("Building full-text index on metadata");
+            for (auto&& stmt : sqlite3FullTextCreate)
+                _exec(std::string(stmt));
+        }
+        enableFullTextSearch(fmt::format("{}", identifier(std::string(sqlite3FullTextTable))), "rowid", fmt::format("{}", identifier("property_value")));
+    } catch (const std::runtime_error& e) {
+        log_warning("Full-text search not available: {}", e.what());
+    }
+}
+
+void Sqlite3Database::startReadPool()
+{
+    if (readPoolSize == 0)
+        return;
+
+    readQueueOpen = true;
+    for (std::size_t index = 0; index < readPoolSize; index++) {
+        sqlite3* db = nullptr;
+        if (sqlite3_open_v2(dbFilePath.c_str(), &db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+            log_error("Sqlite3Database.startReadPool: could not open '{}' for reading: {}", dbFilePath.c_str(), sqlite3_errmsg(db));
+            sqlite3_close(db);
+            break;
+        }
+        sqlite3_busy_timeout(db, READ_BUSY_TIMEOUT);
+        readRunners.push_back(std::make_unique<StdThreadRunner>(
+            fmt::format("SQLiteRead{}", index), [db](void* arg) {
+                auto inst = static_cast<Sqlite3Database*>(arg);
+                inst->readThreadProc(db); }, this));
+    }
+    readPoolSize = readRunners.size();
+    if (readPoolSize == 0)
+        readQueueOpen = false;
+    log_info("Using {} SQLite3 read connection(s)", readPoolSize);
 }
 
 std::shared_ptr<Database> Sqlite3Database::getSelf()
@@ -294,12 +381,34 @@ void Sqlite3Database::handleException(const std::exception& exc, const std::stri
     log_error("Already shutting down.\n{}\n{}", lineMessage, exc.what());
 }
 
+std::shared_ptr<SQLResult> Sqlite3Database::selectPrepared(const std::string& query, const std::vector<SQLParam>& params)
+{
+    try {
+        log_debug("Adding prepared select to Queue: {}", query);
+        auto stask = std::make_shared<SLPreparedSelectTask>(query, params);
+        // the transaction is only visible on the writing connection
+        if (readQueueOpen && transactionThread.load() != std::this_thread::get_id())
+            addReadTask(stask);
+        else
+            addTask(stask);
+        stask->waitForTask();
+        return stask->getResult();
+    } catch (const std::runtime_error& e) {
+        handleException(e, LINE_MESSAGE);
+        return {};
+    }
+}
+
 std::shared_ptr<SQLResult> Sqlite3Database::select(const std::string& query)
 {
     try {
         log_debug("Adding select to Queue: {}", query);
         auto stask = std::make_shared<SLSelectTask>(query);
-        addTask(stask);
+        // the transaction is only visible on the writing connection
+        if (readQueueOpen && transactionThread.load() != std::this_thread::get_id())
+            addReadTask(stask);
+        else
+            addTask(stask);
         stask->waitForTask();
         return stask->getResult();
     } catch (const std::runtime_error& e) {
@@ -383,6 +492,7 @@ void Sqlite3Database::threadProc()
         }
 
         StdThreadRunner::waitFor("Sqlite3Database", [this] { return threadRunner != nullptr; });
+        SLStatementCache statementCache(STATEMENT_CACHE_SIZE);
         auto lock = threadRunner->uniqueLockS("threadProc");
         // tell init() that we are ready
         threadRunner->setReady();
@@ -401,6 +511,8 @@ void Sqlite3Database::threadProc()
                 taskQueue.pop();
 
                 lock.unlock();
+                taskStats.add(task->getAge());
+                task->setStatementCache(&statementCache);
                 try {
                     task->run(db, *this, throwOnError(task));
                     if (task->didContamination())
@@ -437,6 +549,7 @@ void Sqlite3Database::threadProc()
             task->sendSignal("Sorry, SQLite3 thread is shutting down");
         }
 
+        statementCache.clear();
         if (db) {
             log_debug("closing database");
             if (sqlite3_close(db) == SQLITE_OK) {
@@ -451,6 +564,78 @@ void Sqlite3Database::threadProc()
     }
 }
 
+void Sqlite3Database::readThreadProc(sqlite3* db)
+{
+    log_debug("Running read thread");
+    SLStatementCache statementCache(STATEMENT_CACHE_SIZE);
+    auto lock = ReadAutoLock(readMutex);
+    while (true) {
+        readCond.wait(lock, [this] { return !readQueue.empty() || !readQueueOpen; });
+        if (readQueue.empty())
+            break;
+        auto task = std::move(readQueue.front());
+        readQueue.pop();
+
+        lock.unlock();
+        readStats.add(task->getAge());
+        task->setStatementCache(&statementCache);
+        try {
+            task->run(db, *this);
+            task->sendSignal();
+        } catch (const std::runtime_error& e) {
+            task->sendSignal(e.what());
+        } catch (const std::logic_error& e) {
+            task->sendSignal(e.what());
+        }
+        lock.lock();
+    }
+    lock.unlock();
+
+    statementCache.clear();
+    if (sqlite3_close(db) != SQLITE_OK) {
+        log_error("Closing read connection failed");
+    }
+    log_debug("Exiting read thread");
+}
+
+void Sqlite3Database::addReadTask(const std::shared_ptr<SLSelectTask>& task)
+{
+    {
+        ReadAutoLock lock(readMutex);
+        if (!readQueueOpen) {
+            throw_std_runtime_error("SQLite3 read queue is already closed");
+        }
+        readQueue.push(task);
+    }
+    readCond.notify_one();
+}
+
+void Sqlite3Database::QueueStats::add(std::chrono::microseconds wait)
+{
+    auto waitCount = static_cast<long long>(wait.count());
+    ++count;
+    waitTotal += waitCount;
+    auto currentMax = waitMax.load();
+    while (waitCount > currentMax && !waitMax.compare_exchange_weak(currentMax, waitCount)) { }
+}
+
+std::map<std::string, long long> Sqlite3Database::getDriverStats() const
+{
+    auto average = [](const QueueStats& stats) {
+        auto count = stats.count.load();
+        return count > 0 ? stats.waitTotal.load() / count : 0LL;
+    };
+    return {
+        { "sqliteReadConnections", static_cast<long long>(readPoolSize) },
+        { "sqliteTaskCount", taskStats.count.load() },
+        { "sqliteTaskWaitAvgUs", average(taskStats) },
+        { "sqliteTaskWaitMaxUs", taskStats.waitMax.load() },
+        { "sqliteReadCount", readStats.count.load() },
+        { "sqliteReadWaitAvgUs", average(readStats) },
+        { "sqliteReadWaitMaxUs", readStats.waitMax.load() },
+    };
+}
+
 /* Sqlite3BackupTimerSubscriber */
 
 void Sqlite3Database::timerNotify(const std::shared_ptr<Timer::Parameter>& param)
@@ -479,9 +664,25 @@ void Sqlite3Database::addTask(const std::shared_ptr<SLTask>& task, bool onlyIfDi
 void Sqlite3Database::shutdownDriver()
 {
     log_debug("start");
+    if (!readRunners.empty()) {
+        {
+            ReadAutoLock readLock(readMutex);
+            readQueueOpen = false;
+        }
+        readCond.notify_all();
+        for (auto&& runner : readRunners) {
+            runner->join();
+        }
+        readRunners.clear();
+    }
+
     auto lock = threadRunner->uniqueLockS("shutdown");
     if (!shutdownFlag) {
         shutdownFlag = true;
+        auto stats = getDriverStats();
+        log_info("SQLite3 queue wait: {} tasks avg {} us max {} us, {} selects on {} read connection(s) avg {} us max {} us",
+            stats["sqliteTaskCount"], stats["sqliteTaskWaitAvgUs"], stats["sqliteTaskWaitMaxUs"],
+            stats["sqliteReadCount"], stats["sqliteReadConnections"], stats["sqliteReadWaitAvgUs"], stats["sqliteReadWaitMaxUs"]);
         if (hasBackupTimer && timer) {
             timer->removeTimerSubscriber(this, nullptr);
         }
@@ -522,16 +723,42 @@ void Sqlite3DatabaseWithTransactions::beginTransaction(std::string_view tName)
         StdThreadRunner::waitFor(
             fmt::format("SqliteDatabase.begin {}", tName), [this] { return !inTransaction; }, 100);
         inTransaction = true;
+        transactionThread = std::this_thread::get_id();
         _exec("BEGIN TRANSACTION");
     }
 }
 
+void Sqlite3DatabaseWithTransactions::beginReadTransaction(std::string_view tName)
+{
+    // reads of the thread owning the write transaction are part of it
+    if (transactionThread.load() == std::this_thread::get_id()) {
+        log_debug("READ TRANSACTION {} in open transaction", tName);
+        return;
+    }
+    // with WAL each read connection sees a consistent snapshot, no need to block the writer
+    if (hasReadPool()) {
+        log_debug("READ TRANSACTION {} on read connections", tName);
+        return;
+    }
+    beginTransaction(tName);
+    inReadTransaction = transactionThread.load() == std::this_thread::get_id();
+}
+
+void Sqlite3DatabaseWithTransactions::commitRead(std::string_view tName)
+{
+    // only end the transaction beginReadTransaction of this thread started
+    if (inReadTransaction && transactionThread.load() == std::this_thread::get_id())
+        commit(tName);
+}
+
 void Sqlite3DatabaseWithTransactions::rollback(std::string_view tName)
 {
     if (use_transaction && inTransaction) {
         log_debug("ROLLBACK {} {}", tName, inTransaction);
         _exec("ROLLBACK");
         inTransaction = false;
+        inReadTransaction = false;
+        transactionThread = std::thread::id();
     }
 }
 
@@ -541,5 +768,7 @@ void Sqlite3DatabaseWithTransactions::commit(std::string_view tName)
         log_debug("COMMIT {} {}", tName, inTransaction);
         _exec("COMMIT");
         inTransaction = false;
+        inReadTransaction = false;
+        transactionThread = std::thread::id();
     }
 }
@@ -39,12 +39,16 @@
 #include "util/thread_runner.h"
 #include "util/timer.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <thread>
 
 class Sqlite3Database;
 class Sqlite3Result;
 class SLTask;
+class SLSelectTask;
 
 extern "C" {
 struct sqlite3;
@@ -68,11 +72,17 @@ public:
     void timerNotify(const std::shared_ptr<Timer::Parameter>& param) override;
 
     void dropTables() override;
+    std::map<std::string, long long> getDriverStats() const override;
 
 protected:
     void _exec(const std::string& query) override;
     std::string prepareDatabase(const fs::path& dbFilePath, GrbFile& dbFile);
 
+    /// @brief thread that holds the open transaction, its selects must see uncommitted changes
+    std::atomic<std::thread::id> transactionThread {};
+    /// @brief selects outside of transactions run on the read-only connections
+    bool hasReadPool() const { return readQueueOpen; }
+
 private:
     void prepare();
     void run() override;
@@ -83,6 +93,7 @@ private:
     std::string quote(const std::string& value) const override;
 
     std::shared_ptr<SQLResult> select(const std::string& query) override;
+    std::shared_ptr<SQLResult> selectPrepared(const std::string& query, const std::vector<SQLParam>& params) override;
     void del(std::string_view tableName, const std::string& clause, const std::vector<int>& ids) override;
     void execOnTable(std::string_view tableName, const std::string& query, int objId) override;
     int exec(const std::string& query, const std::string& getLastInsertId = "") override;
@@ -100,6 +111,34 @@ private:
 
     void addTask(const std::shared_ptr<SLTask>& task, bool onlyIfDirty = false);
 
+    /// @brief create or remove full-text index depending on config
+    void initFullText();
+    /// @brief open read-only connections after database is initialised
+    void startReadPool();
+    void readThreadProc(sqlite3* db);
+    /// @brief queue select for the read-only connections
+    void addReadTask(const std::shared_ptr<SLSelectTask>& task);
+
+    /// @brief number of read-only connections, 0 disables the read pool
+    std::size_t readPoolSize {};
+    std::vector<std::unique_ptr<StdThreadRunner>> readRunners;
+    /// @brief the selects to be done by the read-only connections
+    std::queue<std::shared_ptr<SLSelectTask>> readQueue;
+    std::atomic_bool readQueueOpen {};
+    std::mutex readMutex;
+    using ReadAutoLock = std::unique_lock<std::mutex>;
+    std::condition_variable readCond;
+
+    /// @brief queue wait statistics for tasks of one queue
+    struct QueueStats {
+        std::atomic_llong count {};
+        std::atomic_llong waitTotal {};
+        std::atomic_llong waitMax {};
+        void add(std::chrono::microseconds wait);
+    };
+    QueueStats taskStats;
+    QueueStats readStats;
+
     std::shared_ptr<Timer> timer;
 
     /// @brief increased by shutdown attempt if the sqlite3 thread should terminate
@@ -121,7 +160,7 @@ private:
     bool dirty {};
     bool dbInitDone {};
     bool hasBackupTimer {};
-    int sqliteStatus {};
+    std::atomic_int sqliteStatus {};
     /// @brief maximum number of attempts to terminate gracefully
     int shutdownAttempts { 5 };
     fs::path dbFilePath;
@@ -139,6 +178,12 @@ public:
     void beginTransaction(std::string_view tName) override;
     void rollback(std::string_view tName) override;
     void commit(std::string_view tName) override;
+    void beginReadTransaction(std::string_view tName) override;
+    void commitRead(std::string_view tName) override;
+
+private:
+    /// @brief current transaction was started by beginReadTransaction, only changed by the thread owning it
+    std::atomic_bool inReadTransaction { false };
 };
 
 #endif // __SQLITE3_STORAGE_H__
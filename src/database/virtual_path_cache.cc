@@ -0,0 +1,150 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    virtual_path_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file database/virtual_path_cache.cc
+#define GRB_LOG_FAC GrbLogFacility::database
+
+#include "virtual_path_cache.h" // API
+
+#include "common.h"
+#include "util/logger.h"
+
+void VirtualPathCache::load(const std::vector<Entry>& entries, std::uint64_t generation)
+{
+    AutoLock lock(mutex);
+    if (generation != this->generation) {
+        log_debug("Virtual containers changed while loading, retry on next use");
+        return;
+    }
+    ids.clear();
+    locations.clear();
+    sharedLocations.clear();
+    complete = true;
+    // objects without reference are preferred like in Database::findObjectByPath
+    for (auto&& entry : entries) {
+        if (entry.hasReference)
+            continue;
+        if (ids.find(entry.location) != ids.end())
+            sharedLocations.insert(entry.location);
+        else
+            insert(entry.location, entry.id);
+    }
+    for (auto&& entry : entries) {
+        if (!entry.hasReference)
+            continue;
+        if (ids.find(entry.location) != ids.end())
+            sharedLocations.insert(entry.location);
+        else
+            insert(entry.location, entry.id);
+    }
+    loaded = true;
+    log_debug("Loaded {} virtual container(s), complete {}", ids.size(), complete);
+}
+
+bool VirtualPathCache::isLoaded() const
+{
+    AutoLock lock(mutex);
+    return loaded;
+}
+
+std::uint64_t VirtualPathCache::getGeneration() const
+{
+    AutoLock lock(mutex);
+    return generation;
+}
+
+std::optional<int> VirtualPathCache::get(const std::string& location) const
+{
+    AutoLock lock(mutex);
+    if (!loaded)
+        return std::nullopt;
+    auto entry = ids.find(location);
+    if (entry != ids.end())
+        return entry->second;
+    if (complete)
+        return INVALID_OBJECT_ID;
+    return std::nullopt;
+}
+
+void VirtualPathCache::set(const std::string& location, int id)
+{
+    AutoLock lock(mutex);
+    generation++;
+    if (!loaded)
+        return;
+    auto entry = locations.find(id);
+    if (entry != locations.end()) {
+        ids.erase(entry->second);
+        locations.erase(entry);
+    }
+    insert(location, id);
+}
+
+void VirtualPathCache::erase(int id)
+{
+    AutoLock lock(mutex);
+    generation++;
+    auto entry = locations.find(id);
+    if (entry == locations.end())
+        return;
+    auto location = ids.find(entry->second);
+    if (location != ids.end() && location->second == id)
+        ids.erase(location);
+    // another container may still use the location
+    if (sharedLocations.find(entry->second) != sharedLocations.end())
+        complete = false;
+    locations.erase(entry);
+}
+
+void VirtualPathCache::clear()
+{
+    AutoLock lock(mutex);
+    ids.clear();
+    locations.clear();
+    sharedLocations.clear();
+    generation++;
+    loaded = false;
+    complete = false;
+}
+
+std::size_t VirtualPathCache::size() const
+{
+    AutoLock lock(mutex);
+    return ids.size();
+}
+
+void VirtualPathCache::insert(const std::string& location, int id)
+{
+    if (ids.find(location) == ids.end() && ids.size() >= maxSize) {
+        // misses can no longer be answered without database
+        complete = false;
+        return;
+    }
+    auto entry = ids.find(location);
+    if (entry != ids.end() && entry->second != id) {
+        locations.erase(entry->second);
+        sharedLocations.insert(location);
+    }
+    ids[location] = id;
+    locations[id] = location;
+}
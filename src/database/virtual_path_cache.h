@@ -0,0 +1,92 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    virtual_path_cache.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file database/virtual_path_cache.h
+/// @brief Definition of the VirtualPathCache class.
+
+#ifndef __VIRTUAL_PATH_CACHE_H__
+#define __VIRTUAL_PATH_CACHE_H__
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/// @brief Ids of virtual containers by location
+///
+/// The cache is filled with all virtual containers of the database when it is first used and changed with each container
+/// that is added, updated or removed. As long as all containers fit into the cache, paths that are not cached do not exist.
+class VirtualPathCache {
+public:
+    struct Entry {
+        std::string location;
+        int id;
+        /// @brief container references another object
+        bool hasReference;
+    };
+
+    explicit VirtualPathCache(std::size_t maxSize)
+        : maxSize(maxSize)
+    {
+    }
+
+    /// @brief replace content by containers read from database
+    /// @param generation value of getGeneration() before the database was read, entries are dropped if it changed
+    void load(const std::vector<Entry>& entries, std::uint64_t generation);
+    bool isLoaded() const;
+    /// @brief counter that increases with each change
+    std::uint64_t getGeneration() const;
+
+    /// @brief get id of container at location
+    /// @return id, INVALID_OBJECT_ID if there is no such container, std::nullopt if the database has to be asked
+    std::optional<int> get(const std::string& location) const;
+    /// @brief store container after it was written to database
+    void set(const std::string& location, int id);
+    /// @brief drop container, e.g. when it is removed
+    void erase(int id);
+    void clear();
+
+    std::size_t size() const;
+
+private:
+    /// @brief add entry, lock must be held
+    void insert(const std::string& location, int id);
+
+    std::size_t maxSize;
+    std::uint64_t generation {};
+    bool loaded { false };
+    /// @brief all virtual containers of the database are cached
+    bool complete { false };
+    std::unordered_map<std::string, int> ids;
+    std::unordered_map<int, std::string> locations;
+    /// @brief locations of more than one container, only one of them is cached
+    std::unordered_set<std::string> sharedLocations;
+
+    mutable std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+};
+
+#endif // __VIRTUAL_PATH_CACHE_H__
@@ -0,0 +1,155 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    read_ahead_io_handler.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file iohandler/read_ahead_io_handler.cc
+#define GRB_LOG_FAC GrbLogFacility::iohandler
+
+#include "read_ahead_io_handler.h" // API
+
+#include "exceptions.h"
+#include "util/logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// @brief Amount of data the kernel is asked to load ahead of the read position
+static constexpr off_t READ_AHEAD_SIZE = 4 * 1024 * 1024;
+
+ReadAheadIOHandler::ReadAheadIOHandler(fs::path filename, off_t offset)
+    : path(std::move(filename))
+    , offset(offset)
+{
+    log_debug("path = {}", path.string());
+}
+
+ReadAheadIOHandler::~ReadAheadIOHandler()
+{
+    if (fd >= 0)
+        ::close(fd);
+}
+
+void ReadAheadIOHandler::open(enum UpnpOpenFileMode mode)
+{
+    if (mode != UPNP_READ)
+        throw_std_runtime_error("open: UpnpOpenFileMode mode not supported");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw_std_runtime_error("Failed to open {}: {}", path.string(), std::strerror(errno));
+
+    struct stat statbuf {};
+    if (fstat(fd, &statbuf) != 0)
+        throw_std_runtime_error("Failed to stat {}: {}", path.string(), std::strerror(errno));
+    fileSize = statbuf.st_size;
+    position = std::clamp<off_t>(offset, 0, fileSize);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    readAhead(true);
+    log_debug("open {}", path.string());
+}
+
+void ReadAheadIOHandler::readAhead(bool force)
+{
+#ifdef POSIX_FADV_WILLNEED
+    // advise next block when half of the previous block is read
+    if (force || position < readAheadEnd - READ_AHEAD_SIZE || position > readAheadEnd - READ_AHEAD_SIZE / 2) {
+        auto length = std::clamp<off_t>(fileSize - position, 0, READ_AHEAD_SIZE);
+        if (length > 0)
+            posix_fadvise(fd, position, length, POSIX_FADV_WILLNEED);
+        readAheadEnd = position + length;
+    }
+#endif
+}
+
+grb_read_t ReadAheadIOHandler::read(std::byte* buf, std::size_t length)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // pread stops at the current end, so files may shrink or grow while streaming
+    auto count = pread(fd, buf, length, position);
+    if (count < 0) {
+        log_error("Failed to read {}: {}", path.string(), std::strerror(errno));
+        return GRB_READ_ERROR;
+    }
+    if (count == 0)
+        return GRB_READ_END;
+
+    position += count;
+    fileSize = std::max(fileSize, position);
+    readAhead(false);
+
+    log_debug("read {} {}", path.string(), count);
+    return count;
+}
+
+void ReadAheadIOHandler::seek(off_t offset, int whence)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    off_t newPosition;
+    switch (whence) {
+    case SEEK_SET:
+        newPosition = offset;
+        break;
+    case SEEK_CUR:
+        newPosition = position + offset;
+        break;
+    case SEEK_END: {
+        struct stat statbuf {};
+        if (fstat(fd, &statbuf) == 0)
+            fileSize = statbuf.st_size;
+        newPosition = fileSize + offset;
+        break;
+    }
+    default:
+        throw_std_runtime_error("seek: invalid whence {}", whence);
+    }
+    if (newPosition < 0)
+        throw_std_runtime_error("seek: invalid position {}", newPosition);
+
+    position = newPosition;
+    // range request starts here
+    readAhead(true);
+}
+
+off_t ReadAheadIOHandler::tell()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return position;
+}
+
+void ReadAheadIOHandler::close()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    log_debug("close {}", path.string());
+}
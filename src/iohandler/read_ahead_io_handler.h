@@ -0,0 +1,90 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    read_ahead_io_handler.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file iohandler/read_ahead_io_handler.h
+/// @brief Definition of the ReadAheadIOHandler class.
+
+#ifndef __READ_AHEAD_IO_HANDLER_H__
+#define __READ_AHEAD_IO_HANDLER_H__
+
+#include "io_handler.h"
+#include "util/grb_fs.h"
+
+#include <mutex>
+
+/// @brief Allows the web server to read from a file with the kernel reading ahead.
+///
+/// The kernel is advised to read ahead from the current position, which follows
+/// the start of range requests. Data is read with pread without stdio buffer, so files
+/// that shrink or grow while they are streamed are read up to their current end.
+class ReadAheadIOHandler : public IOHandler {
+protected:
+    /// @brief Name of the file.
+    fs::path path;
+
+    /// @brief Descriptor of the file.
+    int fd { -1 };
+
+    /// @brief Size of the file when it was opened or last reached
+    off_t fileSize {};
+
+    /// @brief Current read position
+    off_t position {};
+
+    /// @brief open file with offset
+    off_t offset;
+
+    /// @brief End of the range that was advised to the kernel
+    off_t readAheadEnd {};
+
+    std::mutex mutex;
+
+    /// @brief advise the kernel to load the data following position
+    void readAhead(bool force);
+
+public:
+    /// @brief Sets the filename to work with.
+    explicit ReadAheadIOHandler(fs::path filename, off_t offset = 0);
+    ~ReadAheadIOHandler() override;
+
+    /// @brief Opens file for reading (writing is not supported)
+    void open(enum UpnpOpenFileMode mode) override;
+
+    /// @brief Reads data from the file.
+    /// @param buf Data from the file will be copied into this buffer.
+    /// @param length Number of bytes to be copied into the buffer.
+    grb_read_t read(std::byte* buf, std::size_t length) override;
+
+    /// @brief Performs seek on an open file.
+    /// @param offset Number of bytes to move in the file.
+    /// @param whence The position to move relative to: SEEK_CUR, SEEK_END or SEEK_SET.
+    void seek(off_t offset, int whence) override;
+
+    /// @brief Return the current stream position.
+    off_t tell() override;
+
+    /// @brief Close a previously opened file.
+    void close() override;
+};
+
+#endif // __READ_AHEAD_IO_HANDLER_H__
@@ -181,6 +181,7 @@ bool Exiv2Handler::fillMetadata(
     if (!item || !enabled)
         return false;
 
+    std::lock_guard<std::mutex> lock(exivMutex);
     bool result = true;
     try {
         Exiv2Object exivObj(converterManager, item);
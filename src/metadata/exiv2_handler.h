@@ -38,6 +38,8 @@
 
 #include "metadata_handler.h"
 
+#include <mutex>
+
 /// @brief This class is responsible for reading exif header metadata
 class Exiv2Handler : public MediaMetadataHandler {
 public:
@@ -53,6 +55,10 @@ public:
     std::unique_ptr<IOHandler> serveContent(
         const std::shared_ptr<CdsObject>& obj,
         const std::shared_ptr<CdsResource>& resource) override;
+
+private:
+    /// @brief exiv2 keeps the xmp namespace registry in global state
+    std::mutex exivMutex;
 };
 
 #endif // HAVE_EXIV2
@@ -33,8 +33,13 @@ Gerbera - https://gerbera.io/
 #include "resolution.h"
 #include "util/tools.h"
 
+#include <algorithm>
 #include <libffmpegthumbnailer/filmstripfilter.h>
 #include <libffmpegthumbnailer/videothumbnailer.h>
+#include <mutex>
+
+/// @brief maximum number of thumbnails waiting for pre-generation
+static constexpr std::size_t THUMBNAIL_QUEUE_SIZE = 1000;
 
 /// @brief logger function for thumbnailer issues
 static void ffmpegThLogger(ThumbnailerLogLevel logLevel, const std::string& message)
@@ -128,6 +133,23 @@ public:
     }
 };
 
+/// @brief pool shared by all handlers, so worker count limits thumbnail generation for the whole server
+static std::shared_ptr<ThumbnailPool> getThumbnailPool(int workerCount)
+{
+    static std::mutex poolMutex;
+    static std::weak_ptr<ThumbnailPool> sharedPool;
+
+    std::scoped_lock<std::mutex> lock(poolMutex);
+    auto pool = sharedPool.lock();
+    if (!pool) {
+        if (workerCount > 1)
+            log_warning("Generating {} thumbnails in parallel, ffmpegthumbnailer does not guarantee thread safety", workerCount);
+        pool = std::make_shared<ThumbnailPool>(std::max(workerCount, 1), THUMBNAIL_QUEUE_SIZE);
+        sharedPool = pool;
+    }
+    return pool;
+}
+
 fs::path FfmpegThumbnailerHandler::getThumbnailCachePath(const fs::path& base, const fs::path& movie)
 {
     assert(movie.is_absolute());
@@ -144,19 +166,73 @@ std::optional<std::vector<std::byte>> FfmpegThumbnailerHandler::readThumbnailCac
 }
 
 void FfmpegThumbnailerHandler::writeThumbnailCacheFile(
-    const fs::path& movieFilename,
+    const fs::path& cacheFile,
     const std::byte* data,
-    std::size_t size) const
+    std::size_t size)
 {
     try {
-        auto path = getThumbnailCachePath(getThumbnailCacheBasePath(), movieFilename);
-        fs::create_directories(path.parent_path());
-        GrbFile(path).writeBinaryFile(data, size);
+        fs::create_directories(cacheFile.parent_path());
+        GrbFile(cacheFile).writeBinaryFile(data, size);
     } catch (const std::runtime_error& e) {
         log_error("Failed to write thumbnail cache: {}", e.what());
     }
 }
 
+ThumbnailPool::Generator FfmpegThumbnailerHandler::createGenerator(
+    const fs::path& itemLocation,
+    const std::shared_ptr<CdsResource>& resource) const
+{
+    double rotation = 0;
+    if (doRotate && resource) {
+        // 1: Normal (0° rotation)
+        // 3: Upside-down (180° rotation)
+        // 6: Rotated 90° counterclockwise (270° clockwise)
+        // 8: Rotated 90° clockwise (270° counterclockwise)
+        int orientation = stoiString(resource->getAttribute(ResourceAttribute::ORIENTATION));
+        if (orientation == 6) {
+            rotation = 90;
+        } else if (orientation == 8) {
+            rotation = -90;
+        } else if (orientation == 3) {
+            rotation = 180;
+        }
+    }
+    auto cacheFile = cacheEnabled ? getThumbnailCachePath(getThumbnailCacheBasePath(), itemLocation) : fs::path();
+
+    // settings are copied, queued pre-generation may outlive the handler
+    return [itemLocation, cacheFile, rotation, thumbSize = thumbSize, seekPercentage = seekPercentage, imageQuality = imageQuality, stripOverlay = stripOverlay]() -> ThumbnailPool::Thumbnail {
+        std::unique_ptr<ffmpegthumbnailer::FilmStripFilter> filmStripFilter;
+        std::unique_ptr<RotationFilter> rotationFilter;
+        try {
+            auto th = ffmpegthumbnailer::VideoThumbnailer(thumbSize, false, true, imageQuality, false);
+
+            th.setLogCallback(ffmpegThLogger);
+            th.setSeekPercentage(seekPercentage);
+            if (rotation != 0) {
+                rotationFilter = std::make_unique<RotationFilter>(rotation);
+                th.addFilter(rotationFilter.get());
+            }
+            if (stripOverlay) {
+                filmStripFilter = std::make_unique<ffmpegthumbnailer::FilmStripFilter>();
+                th.addFilter(filmStripFilter.get());
+            }
+
+            log_debug("Generating thumbnail for file: {}", itemLocation.c_str());
+
+            std::vector<uint8_t> img;
+            th.generateThumbnail(itemLocation, Jpeg, img);
+            auto data = reinterpret_cast<std::byte*>(img.data());
+            if (!cacheFile.empty()) {
+                writeThumbnailCacheFile(cacheFile, data, img.size());
+            }
+            return std::vector<std::byte>(data, data + img.size());
+        } catch (const std::logic_error& e) {
+            log_warning("Thumbnail generation failed for file {}: {}", itemLocation.c_str(), e.what());
+            return std::nullopt;
+        }
+    };
+}
+
 std::unique_ptr<IOHandler> FfmpegThumbnailerHandler::serveContent(
     const std::shared_ptr<CdsObject>& obj,
     const std::shared_ptr<CdsResource>& resource)
@@ -181,52 +257,11 @@ std::unique_ptr<IOHandler> FfmpegThumbnailerHandler::serveContent(
         }
     }
 
-    std::unique_ptr<ffmpegthumbnailer::FilmStripFilter> filmStripFilter;
-    std::unique_ptr<RotationFilter> rotationFilter;
-    try {
-        auto thumbLock = std::scoped_lock<std::mutex>(thumb_mutex);
-
-        auto th = ffmpegthumbnailer::VideoThumbnailer(thumbSize, false, true, imageQuality, false);
-
-        th.setLogCallback(ffmpegThLogger);
-        th.setSeekPercentage(seekPercentage);
-        if (doRotate && resource) {
-            // 1: Normal (0° rotation)
-            // 3: Upside-down (180° rotation)
-            // 6: Rotated 90° counterclockwise (270° clockwise)
-            // 8: Rotated 90° clockwise (270° counterclockwise)
-            int orientation = stoiString(resource->getAttribute(ResourceAttribute::ORIENTATION));
-            double rotation = 0;
-            if (orientation == 6) {
-                rotation = 90;
-            } else if (orientation == 8) {
-                rotation = -90;
-            } else if (orientation == 3) {
-                rotation = 180;
-            }
-            if (rotation != 0) {
-                rotationFilter = std::make_unique<RotationFilter>(rotation);
-                th.addFilter(rotationFilter.get());
-            }
-        }
-        if (stripOverlay) {
-            filmStripFilter = std::make_unique<ffmpegthumbnailer::FilmStripFilter>();
-            th.addFilter(filmStripFilter.get());
-        }
-
-        log_debug("Generating thumbnail for file: {}", itemLocation.c_str());
-
-        std::vector<uint8_t> img;
-        th.generateThumbnail(itemLocation, Jpeg, img);
-        if (cacheEnabled) {
-            writeThumbnailCacheFile(itemLocation, reinterpret_cast<std::byte*>(img.data()), img.size());
-        }
-
-        return std::make_unique<MemIOHandler>(img.data(), img.size());
-    } catch (const std::logic_error& e) {
-        log_warning("Thumbnail generation failed for file {}: {}", itemLocation.c_str(), e.what());
+    // concurrent requests for the same file share one generation
+    auto img = thumbnailPool->get(itemLocation, createGenerator(itemLocation, resource));
+    if (!img)
         return nullptr;
-    }
+    return std::make_unique<MemIOHandler>(img->data(), img->size());
 }
 
 bool FfmpegThumbnailerHandler::fillMetadata(
@@ -260,6 +295,11 @@ bool FfmpegThumbnailerHandler::fillMetadata(
         thumbResource->addAttribute(ResourceAttribute::RESOLUTION, fmt::format("{}x{}", x, y));
         item->addResource(thumbResource);
         log_debug("Adding resource to {} for {} thumbnail", itemLocation.c_str(), EnumMapper::mapObjectType(mediaType));
+
+        std::error_code ec;
+        if (pregenerate && cacheEnabled && !fs::exists(getThumbnailCachePath(getThumbnailCacheBasePath(), itemLocation), ec)) {
+            thumbnailPool->prefetch(itemLocation, createGenerator(itemLocation, thumbResource));
+        }
         return true;
 
     } catch (const std::runtime_error& e) {
@@ -282,6 +322,7 @@ FfmpegThumbnailerHandler::FfmpegThumbnailerHandler(
         seekPercentage = config->getIntOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_SEEK_PERCENTAGE);
         imageQuality = config->getIntOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_IMAGE_QUALITY);
         cacheEnabled = config->getBoolOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_ENABLED);
+        pregenerate = config->getBoolOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR_PREGENERATE);
         stripOverlay = config->getBoolOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_FILMSTRIP_OVERLAY);
         doRotate = config->getBoolOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_ROTATE);
         auto configuredDir = config->getOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_CACHE_DIR);
@@ -291,6 +332,7 @@ FfmpegThumbnailerHandler::FfmpegThumbnailerHandler(
             auto home = config->getOption(ConfigVal::SERVER_HOME);
             cachePath = fs::path(home) / "cache-dir";
         }
+        thumbnailPool = getThumbnailPool(config->getIntOption(ConfigVal::SERVER_EXTOPTS_FFMPEGTHUMBNAILER_WORKER_COUNT));
     }
 }
 
@@ -26,11 +26,11 @@ Gerbera - https://gerbera.io/
 #ifdef HAVE_FFMPEGTHUMBNAILER
 
 #include "metadata_handler.h"
+#include "thumbnail_pool.h"
 
 #include "util/grb_fs.h"
 
 #include <memory>
-#include <mutex>
 
 class CdsObject;
 class IOHandler;
@@ -63,9 +63,8 @@ protected:
     static fs::path getThumbnailCachePath(const fs::path& base, const fs::path& movie);
 
 private:
-    /// @brief The ffmpegthumbnailer code (ffmpeg?) is not threading safe.
-    /// Add a lock around the usage to avoid crashing randomly.
-    mutable std::mutex thumb_mutex;
+    /// @brief threads shared by all handlers, one worker by default as ffmpegthumbnailer is not guaranteed to be thread safe
+    std::shared_ptr<ThumbnailPool> thumbnailPool;
     /// @brief location of cached thumbnails
     fs::path cachePath;
     /// @brief distinguish video or image
@@ -82,16 +81,22 @@ private:
     int imageQuality;
     /// @brief use thumbnail cache
     bool cacheEnabled;
+    /// @brief generate thumbnails into cache during import
+    bool pregenerate;
     /// @brief add film strip overlay
     bool stripOverlay;
     /// @brief rotate images automatically based on orientation
     bool doRotate;
 
     /// @brief cache generated thumb
-    void writeThumbnailCacheFile(
-        const fs::path& movieFilename,
+    static void writeThumbnailCacheFile(
+        const fs::path& cacheFile,
         const std::byte* data,
-        std::size_t size) const;
+        std::size_t size);
+    /// @brief create generator that does not depend on the lifetime of the handler
+    ThumbnailPool::Generator createGenerator(
+        const fs::path& itemLocation,
+        const std::shared_ptr<CdsResource>& resource) const;
 };
 
 #endif // HAVE_FFMPEGTHUMBNAILER
@@ -137,6 +137,7 @@ bool MatroskaHandler::fillMetadata(
     if (!item || !enabled)
         return false;
 
+    std::lock_guard<std::mutex> lock(parseMutex);
     parseMKV(item, nullptr);
     return activeFlag == 0;
 }
@@ -150,6 +151,7 @@ std::unique_ptr<IOHandler> MatroskaHandler::serveContent(
         return nullptr;
 
     std::unique_ptr<MemIOHandler> ioHandler;
+    std::lock_guard<std::mutex> lock(parseMutex);
     parseMKV(item, &ioHandler);
 
     return ioHandler;
@@ -40,6 +40,7 @@
 #endif
 
 #include <map>
+#include <mutex>
 
 // forward declarations
 class CdsItem;
@@ -65,6 +66,8 @@ private:
     /// @brief indicate that search for item is still active
     int activeFlag {};
     std::map<std::string, std::string> mkvTags;
+    /// @brief parse state is kept in members, so only one file can be parsed at a time
+    std::mutex parseMutex;
 
     /// @brief Parse Matroska file data
     void parseMKV(
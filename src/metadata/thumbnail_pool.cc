@@ -0,0 +1,173 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    thumbnail_pool.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file metadata/thumbnail_pool.cc
+#define GRB_LOG_FAC GrbLogFacility::thumbnailer
+
+#include "thumbnail_pool.h" // API
+
+#include "util/logger.h"
+
+#include <algorithm>
+
+ThumbnailPool::ThumbnailPool(std::size_t workerCount, std::size_t queueSize)
+    : workerCount(workerCount)
+    , queueSize(queueSize)
+{
+}
+
+ThumbnailPool::~ThumbnailPool()
+{
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        shutdown = true;
+    }
+    cond.notify_all();
+    for (auto&& worker : workers) {
+        worker->join();
+    }
+    // nobody waits for pre-generations, but release waiting clients
+    for (auto&& [location, job] : pending) {
+        if (!job->started)
+            job->promise.set_value(std::nullopt);
+    }
+}
+
+std::shared_ptr<ThumbnailPool::Job> ThumbnailPool::createJob(const fs::path& location, Generator generator)
+{
+    auto job = std::make_shared<Job>();
+    job->location = location;
+    job->generator = std::move(generator);
+    job->result = job->promise.get_future().share();
+    pending[location] = job;
+    return job;
+}
+
+ThumbnailPool::Thumbnail ThumbnailPool::get(const fs::path& location, Generator generator)
+{
+    std::shared_future<Thumbnail> result;
+    std::shared_ptr<Job> inlineJob;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        startWorkers();
+        auto entry = pending.find(location);
+        if (entry == pending.end()) {
+            auto job = createJob(location, std::move(generator));
+            requests.push_back(job);
+            result = job->result;
+        } else {
+            auto&& job = entry->second;
+            auto queued = std::find(prefetches.begin(), prefetches.end(), job);
+            if (queued != prefetches.end()) {
+                // client is waiting, so pre-generation moves up
+                prefetches.erase(queued);
+                requests.push_back(job);
+            }
+            log_debug("Waiting for pending thumbnail of {}", location.c_str());
+            result = job->result;
+            generator = nullptr; // release captured data while waiting
+        }
+        if (workers.empty()) {
+            // without worker threads the first client of a location generates it
+            auto&& job = pending.at(location);
+            auto queued = std::find(requests.begin(), requests.end(), job);
+            if (queued != requests.end()) {
+                requests.erase(queued);
+                job->started = true;
+                inlineJob = job;
+            }
+        }
+    }
+    if (inlineJob)
+        generate(inlineJob);
+    else
+        cond.notify_one();
+    return result.get();
+}
+
+bool ThumbnailPool::prefetch(const fs::path& location, Generator generator)
+{
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        startWorkers();
+        // pre-generation needs a worker, clients do not wait for it
+        if (shutdown || workers.empty() || prefetches.size() >= queueSize || pending.find(location) != pending.end())
+            return false;
+        prefetches.push_back(createJob(location, std::move(generator)));
+    }
+    cond.notify_one();
+    return true;
+}
+
+std::size_t ThumbnailPool::size() const
+{
+    std::scoped_lock<std::mutex> lock(mutex);
+    return pending.size();
+}
+
+void ThumbnailPool::startWorkers()
+{
+    if (workersStarted)
+        return;
+    workersStarted = true;
+    workers.reserve(workerCount);
+    for (std::size_t worker = 0; worker < workerCount; worker++) {
+        auto runner = std::make_unique<StdThreadRunner>(fmt::format("ThumbnailWorker{}", worker), [this](void*) { run(); }, nullptr);
+        if (runner->isAlive())
+            workers.push_back(std::move(runner));
+    }
+    if (workers.size() < workerCount)
+        log_warning("Started {} of {} thumbnail workers", workers.size(), workerCount);
+}
+
+void ThumbnailPool::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        cond.wait(lock, [this] { return shutdown || !requests.empty() || !prefetches.empty(); });
+        if (shutdown)
+            break;
+
+        auto&& queue = requests.empty() ? prefetches : requests;
+        auto job = std::move(queue.front());
+        queue.pop_front();
+        job->started = true;
+        lock.unlock();
+        generate(job);
+        lock.lock();
+    }
+}
+
+void ThumbnailPool::generate(const std::shared_ptr<Job>& job)
+{
+    Thumbnail thumbnail;
+    try {
+        thumbnail = job->generator();
+    } catch (const std::exception& ex) {
+        log_warning("Thumbnail generation failed for file {}: {}", job->location.c_str(), ex.what());
+    }
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    pending.erase(job->location);
+    job->promise.set_value(std::move(thumbnail));
+}
@@ -0,0 +1,101 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    thumbnail_pool.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file metadata/thumbnail_pool.h
+/// @brief Definition of the ThumbnailPool class.
+
+#ifndef __METADATA_THUMBNAIL_POOL_H__
+#define __METADATA_THUMBNAIL_POOL_H__
+
+#include "util/grb_fs.h"
+#include "util/thread_runner.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/// @brief Bounded set of threads that generate thumbnails
+///
+/// Requests for the same file share one generation. Requests of clients run before
+/// pre-generation, which is dropped when its queue is full.
+class ThumbnailPool {
+public:
+    using Thumbnail = std::optional<std::vector<std::byte>>;
+    using Generator = std::function<Thumbnail()>;
+
+    /// @param workerCount maximum number of parallel generations, without workers clients generate their thumbnails
+    /// @param queueSize maximum number of queued pre-generations
+    ThumbnailPool(std::size_t workerCount, std::size_t queueSize);
+    ~ThumbnailPool();
+
+    ThumbnailPool(const ThumbnailPool&) = delete;
+    ThumbnailPool& operator=(const ThumbnailPool&) = delete;
+
+    /// @brief generate thumbnail of location and wait for the result
+    Thumbnail get(const fs::path& location, Generator generator);
+    /// @brief queue generation of thumbnail for location without waiting
+    /// @return false if location is already pending or queue is full
+    bool prefetch(const fs::path& location, Generator generator);
+
+    /// @brief number of queued and running generations
+    std::size_t size() const;
+
+private:
+    struct Job {
+        fs::path location;
+        Generator generator;
+        std::promise<Thumbnail> promise;
+        std::shared_future<Thumbnail> result;
+        bool started {};
+    };
+
+    std::size_t workerCount;
+    std::size_t queueSize;
+    bool shutdown {};
+
+    mutable std::mutex mutex;
+    std::condition_variable cond;
+    /// @brief generations requested by clients
+    std::deque<std::shared_ptr<Job>> requests;
+    /// @brief pre-generations, only run when no client is waiting
+    std::deque<std::shared_ptr<Job>> prefetches;
+    /// @brief queued and running generations by location
+    std::map<fs::path, std::shared_ptr<Job>> pending;
+    /// @brief started on first request, only threads that are running
+    std::vector<std::unique_ptr<StdThreadRunner>> workers;
+    bool workersStarted {};
+
+    std::shared_ptr<Job> createJob(const fs::path& location, Generator generator);
+    void startWorkers();
+    void run();
+    /// @brief run generator of started job and hand out the result
+    void generate(const std::shared_ptr<Job>& job);
+};
+
+#endif // __METADATA_THUMBNAIL_POOL_H__
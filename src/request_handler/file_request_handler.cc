@@ -44,6 +44,7 @@
 #include "database/db_param.h"
 #include "exceptions.h"
 #include "iohandler/file_io_handler.h"
+#include "iohandler/read_ahead_io_handler.h"
 #include "metadata/metadata_handler.h"
 #include "metadata/metadata_service.h"
 #include "transcoding/transcode_dispatcher.h"
@@ -471,6 +472,8 @@ std::unique_ptr<IOHandler> FileRequestHandler::open(
     }
 
     // Boring old file
+    if (config->getBoolOption(ConfigVal::SERVER_READ_AHEAD_FILE_IO))
+        return std::make_unique<ReadAheadIOHandler>(path, offset);
     return std::make_unique<FileIOHandler>(path, offset);
 }
 
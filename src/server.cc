@@ -57,6 +57,7 @@
 #include "upnp/conn_mgr_service.h"
 #include "upnp/cont_dir_service.h"
 #include "upnp/headers.h"
+#include "upnp/browse_result_cache.h"
 #include "upnp/mr_reg_service.h"
 #include "upnp/upnp_common.h"
 #include "upnp/xml_builder.h"
@@ -141,6 +142,7 @@ void Server::init(
     sessionManager = std::make_shared<Web::SessionManager>(config, timer);
     context = std::make_shared<Context>(definition, config, clientManager, mime, database, sessionManager, converterManager);
 
+    browseCache = std::make_shared<BrowseResultCache>(config->getUIntOption(ConfigVal::UPNP_BROWSE_CACHE_SIZE));
     content = std::make_shared<ContentManager>(context, self, timer);
 
 #ifdef HAVE_LASTFM
@@ -249,7 +251,7 @@ void Server::run()
 
     log_debug("Creating ContentDirectoryService");
     serviceList.push_back(std::make_unique<ContentDirectoryService>(context, upnpXmlBuilder, rootDeviceHandle,
-        config->getIntOption(ConfigVal::SERVER_UPNP_TITLE_AND_DESC_STRING_LIMIT), offline));
+        config->getIntOption(ConfigVal::SERVER_UPNP_TITLE_AND_DESC_STRING_LIMIT), offline, browseCache));
 
     log_debug("Creating ConnectionManagerService");
     serviceList.push_back(std::make_unique<ConnectionManagerService>(context, upnpXmlBuilder, rootDeviceHandle));
@@ -42,6 +42,7 @@
 
 // forward declarations
 class ActionRequest;
+class BrowseResultCache;
 class ClientManager;
 class Config;
 class ConfigDefinition;
@@ -104,6 +105,8 @@ public:
     void sendSubscriptionUpdate(const std::string& updateString, const std::string& serviceId);
 
     std::shared_ptr<Content> getContent() const { return content; }
+    /// @brief cache of rendered browse results, shared by ContentDirectoryService and UpdateManager
+    const std::shared_ptr<BrowseResultCache>& getBrowseCache() const { return browseCache; }
     std::vector<std::string> getCorsHosts() const { return corsHosts; }
 
 protected:
@@ -118,6 +121,7 @@ protected:
     std::shared_ptr<Timer> timer;
     std::shared_ptr<Content> content;
     std::shared_ptr<MetadataService> metadataService;
+    std::shared_ptr<BrowseResultCache> browseCache;
     std::shared_ptr<Server> self;
 
     std::string ip;
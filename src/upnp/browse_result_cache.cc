@@ -0,0 +1,146 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    browse_result_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file upnp/browse_result_cache.cc
+#define GRB_LOG_FAC GrbLogFacility::cds
+
+#include "browse_result_cache.h" // API
+
+#include "cds/cds_objects.h"
+
+/// @brief estimated memory for map, list and set nodes of an entry
+static constexpr std::size_t ENTRY_OVERHEAD = 256;
+
+std::optional<BrowseResult> BrowseResultCache::get(const std::string& key)
+{
+    AutoLock lock(mutex);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        misses++;
+        return {};
+    }
+    hits++;
+    lruList.splice(lruList.begin(), lruList, entry->second.lru);
+    return entry->second.result;
+}
+
+void BrowseResultCache::set(const std::string& key, const std::vector<int>& containers, BrowseResult result, std::uint64_t readGeneration)
+{
+    // key is stored in map, list and container sets
+    std::size_t entryMemory = result.result.size() + 3 * key.size() + containers.size() * sizeof(int) + ENTRY_OVERHEAD;
+    AutoLock lock(mutex);
+    // invalidation may have run before the result was stored
+    if (entryMemory > maxMemory / 2 || readGeneration != generation)
+        return;
+    auto entry = entries.find(key);
+    if (entry != entries.end())
+        erase(entry);
+    while (memory + entryMemory > maxMemory && !lruList.empty())
+        erase(entries.find(lruList.back()));
+
+    lruList.push_front(key);
+    for (auto&& container : containers)
+        containerKeys[container].insert(key);
+    entries.emplace(key, Entry { containers, std::move(result), entryMemory, lruList.begin() });
+    memory += entryMemory;
+}
+
+std::uint64_t BrowseResultCache::getGeneration() const
+{
+    AutoLock lock(mutex);
+    return generation;
+}
+
+std::vector<int> BrowseResultCache::getDependencies(int parentId, const std::vector<std::shared_ptr<CdsObject>>& objects)
+{
+    std::vector<int> result;
+    result.reserve(objects.size() + 1);
+    result.push_back(parentId);
+    for (auto&& obj : objects)
+        result.push_back(obj->getID());
+    return result;
+}
+
+void BrowseResultCache::invalidate(const std::vector<int>& containers)
+{
+    AutoLock lock(mutex);
+    ++generation;
+    for (auto&& container : containers) {
+        auto keys = containerKeys.find(container);
+        if (keys == containerKeys.end())
+            continue;
+        // erase modifies the set of keys
+        auto containerEntries = std::vector<std::string>(keys->second.begin(), keys->second.end());
+        for (auto&& key : containerEntries)
+            erase(entries.find(key));
+    }
+}
+
+void BrowseResultCache::erase(std::unordered_map<std::string, Entry>::iterator entry)
+{
+    for (auto&& container : entry->second.containers) {
+        auto keys = containerKeys.find(container);
+        if (keys == containerKeys.end())
+            continue;
+        keys->second.erase(entry->first);
+        if (keys->second.empty())
+            containerKeys.erase(keys);
+    }
+    memory -= entry->second.memory;
+    lruList.erase(entry->second.lru);
+    entries.erase(entry);
+}
+
+void BrowseResultCache::clear()
+{
+    AutoLock lock(mutex);
+    ++generation;
+    entries.clear();
+    containerKeys.clear();
+    lruList.clear();
+    memory = 0;
+}
+
+std::size_t BrowseResultCache::size() const
+{
+    AutoLock lock(mutex);
+    return entries.size();
+}
+
+std::size_t BrowseResultCache::getMemory() const
+{
+    AutoLock lock(mutex);
+    return memory;
+}
+
+std::size_t BrowseResultCache::getHits() const
+{
+    AutoLock lock(mutex);
+    return hits;
+}
+
+std::size_t BrowseResultCache::getMisses() const
+{
+    AutoLock lock(mutex);
+    return misses;
+}
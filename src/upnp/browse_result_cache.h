@@ -0,0 +1,109 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    browse_result_cache.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file upnp/browse_result_cache.h
+/// @brief Definition of the BrowseResult and BrowseResultCache classes.
+
+#ifndef __UPNP_BROWSE_RESULT_CACHE_H__
+#define __UPNP_BROWSE_RESULT_CACHE_H__
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class CdsObject;
+
+/// @brief Rendered response values of a browse request
+struct BrowseResult {
+    /// @brief escaped DIDL-Lite for the Result element
+    std::string result;
+    std::size_t numberReturned {};
+    int totalMatches {};
+};
+
+/// @brief Keeps rendered browse results of containers, least recently used are dropped first
+///
+/// Entries are dropped when one of their containers changes. Results rendered while a change was running are
+/// not stored, because the key only contains the update id of the browsed container and not of its children.
+/// Results also contain child counts and metadata of the returned objects, so these are dependencies, too.
+class BrowseResultCache {
+public:
+    /// @param maxMemory approximate limit of memory used by the entries in bytes, 0 disables the cache
+    explicit BrowseResultCache(std::size_t maxMemory)
+        : maxMemory(maxMemory)
+    {
+    }
+
+    bool isEnabled() const { return maxMemory > 0; }
+
+    /// @brief get result of request key and count hit or miss
+    std::optional<BrowseResult> get(const std::string& key);
+    /// @brief store result of request key that depends on the contents of containers
+    /// @param generation value of getGeneration() before the database was read
+    void set(const std::string& key, const std::vector<int>& containers, BrowseResult result, std::uint64_t generation);
+    /// @brief counter that increases with each invalidation
+    std::uint64_t getGeneration() const;
+    /// @brief ids of parent and returned objects, a change of any of them makes the browse result stale
+    static std::vector<int> getDependencies(int parentId, const std::vector<std::shared_ptr<CdsObject>>& objects);
+    /// @brief drop all entries depending on one of the containers
+    void invalidate(const std::vector<int>& containers);
+    void clear();
+
+    std::size_t size() const;
+    std::size_t getMemory() const;
+    std::size_t getHits() const;
+    std::size_t getMisses() const;
+
+private:
+    struct Entry {
+        std::vector<int> containers;
+        BrowseResult result;
+        std::size_t memory;
+        std::list<std::string>::iterator lru;
+    };
+
+    /// @brief remove entry and its references, lock must be held
+    void erase(std::unordered_map<std::string, Entry>::iterator entry);
+
+    std::size_t maxMemory;
+    std::size_t memory {};
+    std::size_t hits {};
+    std::size_t misses {};
+    std::uint64_t generation {};
+    std::unordered_map<std::string, Entry> entries;
+    /// @brief keys of entries depending on a container
+    std::unordered_map<int, std::unordered_set<std::string>> containerKeys;
+    /// @brief keys, most recently used first
+    std::list<std::string> lruList;
+
+    mutable std::mutex mutex;
+    using AutoLock = std::scoped_lock<std::mutex>;
+};
+
+#endif // __UPNP_BROWSE_RESULT_CACHE_H__
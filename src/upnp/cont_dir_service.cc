@@ -47,18 +47,23 @@
 #include "database/sql_database.h"
 #include "exceptions.h"
 #include "subscription_request.h"
+#include "upnp/browse_result_cache.h"
 #include "upnp/clients.h"
 #include "upnp/compat.h"
+#include "upnp/didl_writer.h"
 #include "upnp/quirks.h"
 #include "upnp/xml_builder.h"
+#include "util/grb_net.h"
 #include "util/tools.h"
 
 ContentDirectoryService::ContentDirectoryService(const std::shared_ptr<Context>& context,
     const std::shared_ptr<UpnpXMLBuilder>& xmlBuilder, UpnpDevice_Handle deviceHandle,
-    int stringLimit, bool offline)
+    int stringLimit, bool offline,
+    std::shared_ptr<BrowseResultCache> browseCache)
     : UpnpService(context->getConfig(), xmlBuilder, deviceHandle, UPNP_DESC_CDS_SERVICE_ID, offline)
     , stringLimit(stringLimit)
     , database(context->getDatabase())
+    , browseCache(std::move(browseCache))
 {
     actionMap = {
         { "Browse", [this](ActionRequest& r) { doBrowse(r); } },
@@ -119,6 +124,8 @@ void ContentDirectoryService::doBrowse(ActionRequest& request)
     else if (browseFlag != "BrowseMetadata")
         throw UpnpException(UPNP_SOAP_E_INVALID_ARGS, "Invalid browse flag: " + browseFlag);
 
+    // taken before reading, results of changes that run while rendering are not cached
+    auto cacheGeneration = browseCache ? browseCache->getGeneration() : 0;
     auto parent = database->loadObject(objectID, quirks->getGroup());
     auto upnpClass = parent->getClass();
     log_debug("browse {}", upnpClass);
@@ -131,6 +138,29 @@ void ContentDirectoryService::doBrowse(ActionRequest& request)
     if (config->getBoolOption(ConfigVal::SERVER_HIDE_PC_DIRECTORY))
         flag |= BROWSE_HIDE_FS_ROOT;
 
+    // identical requests of the same client profile render the same result until the container changes
+    auto cacheResult = browseCache && browseCache->isEnabled() && arr.empty() && (flag & BROWSE_DIRECT_CHILDREN);
+    std::string cacheKey;
+    if (cacheResult) {
+        auto profile = quirks ? quirks->getProfile() : nullptr;
+        auto container = std::dynamic_pointer_cast<CdsContainer>(parent);
+        cacheKey = fmt::format("{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}", profile ? profile->name : "", profile ? profile->match : "",
+            quirks->getGroup(), objectID, container ? container->getUpdateID() : 0, flag, startingIndex, requestedCount, filter, sortCriteria);
+        auto cached = browseCache->get(cacheKey);
+        if (cached) {
+            log_debug("Browse result of {} from cache, hits {}, misses {}", objectID, browseCache->getHits(), browseCache->getMisses());
+            auto response = xmlBuilder->createResponse(request.getActionName(), UPNP_DESC_CDS_SERVICE_TYPE);
+            auto respRoot = response->document_element();
+            respRoot.append_child("Result");
+            respRoot.append_child("NumberReturned").append_child(pugi::node_pcdata).set_value(fmt::to_string(cached->numberReturned).c_str());
+            respRoot.append_child("TotalMatches").append_child(pugi::node_pcdata).set_value(fmt::to_string(cached->totalMatches).c_str());
+            respRoot.append_child("UpdateID").append_child(pugi::node_pcdata).set_value(fmt::to_string(systemUpdateID).c_str());
+            request.setResponse(std::move(response), std::move(cached->result));
+            log_debug("end");
+            return;
+        }
+    }
+
     auto param = BrowseParam(parent, flag);
 
     param.setDynamicContainers(!quirks || !quirks->hasFlag(Quirk::SamsungHideDynamic));
@@ -140,6 +170,8 @@ void ContentDirectoryService::doBrowse(ActionRequest& request)
     param.setGroup(quirks->getGroup());
     if (quirks)
         param.setForbiddenDirectories(quirks->getForbiddenDirectories());
+    if (quirks && quirks->getClient() && quirks->getClient()->addr)
+        param.setSession(quirks->getClient()->addr->getNameInfo(false));
 
     // Execute database browse
     try {
@@ -159,38 +191,30 @@ void ContentDirectoryService::doBrowse(ActionRequest& request)
     }
 
     // build response
-    pugi::xml_document didlLite;
-    if (!quirks->hasFlag(Quirk::NoXmlDeclaration)) {
-        auto decl = didlLite.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-    }
-    auto didlLiteRoot = didlLite.append_child("DIDL-Lite");
-    didlLiteRoot.append_attribute(UPNP_XML_DIDL_LITE_NAMESPACE_ATTR) = UPNP_XML_DIDL_LITE_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_DC_NAMESPACE_ATTR) = UPNP_XML_DC_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_UPNP_NAMESPACE_ATTR) = UPNP_XML_UPNP_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_SEC_NAMESPACE_ATTR) = UPNP_XML_SEC_NAMESPACE;
-
+    auto didlLite = DidlWriter(xmlBuilder, quirks, arr.size());
     auto stringLimitClient = stringLimit;
     if (quirks->getStringLimit() > -1) {
         stringLimitClient = quirks->getStringLimit();
     }
 
+    auto filterList = splitString(filter, ',');
     for (auto&& obj : arr) {
         markPlayedItem(obj, obj->getTitle());
-        xmlBuilder->renderObject(obj, splitString(filter, ','), stringLimitClient, didlLiteRoot, quirks);
+        didlLite.renderObject(obj, filterList, stringLimitClient, quirks);
     }
 
-    std::string didlLiteXml = UpnpXMLBuilder::printXml(didlLite, "", quirks && quirks->hasFlag(Quirk::StrictXML) ? pugi::format_no_escapes : 0);
+    std::string didlLiteXml = didlLite.finish();
     log_debug("didl {}", didlLiteXml);
 
     auto response = xmlBuilder->createResponse(request.getActionName(), UPNP_DESC_CDS_SERVICE_TYPE);
     auto respRoot = response->document_element();
-    respRoot.append_child("Result").append_child(pugi::node_pcdata).set_value(didlLiteXml.c_str());
+    respRoot.append_child("Result");
     respRoot.append_child("NumberReturned").append_child(pugi::node_pcdata).set_value(fmt::to_string(arr.size()).c_str());
     respRoot.append_child("TotalMatches").append_child(pugi::node_pcdata).set_value(fmt::to_string(param.getTotalMatches()).c_str());
     respRoot.append_child("UpdateID").append_child(pugi::node_pcdata).set_value(fmt::to_string(systemUpdateID).c_str());
-    request.setResponse(std::move(response));
+    if (cacheResult)
+        browseCache->set(cacheKey, BrowseResultCache::getDependencies(objectID, arr), BrowseResult { didlLiteXml, arr.size(), param.getTotalMatches() }, cacheGeneration);
+    request.setResponse(std::move(response), std::move(didlLiteXml));
 
     log_debug("end");
 }
@@ -221,19 +245,6 @@ void ContentDirectoryService::doSearch(ActionRequest& request)
         containerID, searchCriteria, sortCriteria, startingIndex, filter, requestedCount);
 
     auto&& quirks = request.getQuirks();
-    pugi::xml_document didlLite;
-    if (!quirks || !quirks->hasFlag(Quirk::NoXmlDeclaration)) {
-        auto decl = didlLite.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-    }
-    auto didlLiteRoot = didlLite.append_child("DIDL-Lite");
-    didlLiteRoot.append_attribute(UPNP_XML_DIDL_LITE_NAMESPACE_ATTR) = UPNP_XML_DIDL_LITE_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_DC_NAMESPACE_ATTR) = UPNP_XML_DC_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_UPNP_NAMESPACE_ATTR) = UPNP_XML_UPNP_NAMESPACE;
-    didlLiteRoot.append_attribute(UPNP_XML_SEC_NAMESPACE_ATTR) = UPNP_XML_SEC_NAMESPACE;
-    if (quirks->hasFlag(Quirk::PvSubtitles))
-        didlLiteRoot.append_attribute("xmlns:pv") = "http://www.pv.com/pvns/";
     if (sortCriteria.empty() || quirks->hasFlag(Quirk::ForceSortCriteriaTitle)) {
         sortCriteria = fmt::format("+{}", MetaEnumMapper::getMetaFieldName(MetadataFields::M_TITLE));
     }
@@ -261,14 +272,18 @@ void ContentDirectoryService::doSearch(ActionRequest& request)
     }
 
     // build response
+    auto didlLite = DidlWriter(xmlBuilder, quirks, results.size());
+    if (quirks->hasFlag(Quirk::PvSubtitles))
+        didlLite.addNamespace("xmlns:pv", "http://www.pv.com/pvns/");
     auto stringLimitClient = stringLimit;
     if (quirks->getStringLimit() > -1) {
         stringLimitClient = quirks->getStringLimit();
     }
 
+    auto filterList = splitString(filter, ',');
     for (auto&& cdsObject : results) {
         if (!cdsObject->isItem()) {
-            xmlBuilder->renderObject(cdsObject, splitString(filter, ','), stringLimitClient, didlLiteRoot);
+            didlLite.renderObject(cdsObject, filterList, stringLimitClient);
             continue;
         }
 
@@ -286,19 +301,19 @@ void ContentDirectoryService::doSearch(ActionRequest& request)
         }
 
         markPlayedItem(cdsObject, title);
-        xmlBuilder->renderObject(cdsObject, splitString(filter, ','), stringLimitClient, didlLiteRoot);
+        didlLite.renderObject(cdsObject, filterList, stringLimitClient);
     }
 
-    std::string didlLiteXml = UpnpXMLBuilder::printXml(didlLite, "", quirks && quirks->hasFlag(Quirk::StrictXML) ? pugi::format_no_escapes : 0);
+    std::string didlLiteXml = didlLite.finish();
     log_debug("didl {}", didlLiteXml);
 
     auto response = xmlBuilder->createResponse(request.getActionName(), UPNP_DESC_CDS_SERVICE_TYPE);
     auto respRoot = response->document_element();
-    respRoot.append_child("Result").append_child(pugi::node_pcdata).set_value(didlLiteXml.c_str());
+    respRoot.append_child("Result");
     respRoot.append_child("NumberReturned").append_child(pugi::node_pcdata).set_value(fmt::to_string(results.size()).c_str());
     respRoot.append_child("TotalMatches").append_child(pugi::node_pcdata).set_value(fmt::to_string(searchParam.getTotalMatches()).c_str());
     respRoot.append_child("UpdateID").append_child(pugi::node_pcdata).set_value(fmt::to_string(systemUpdateID).c_str());
-    request.setResponse(std::move(response));
+    request.setResponse(std::move(response), std::move(didlLiteXml));
 
     log_debug("end");
 }
@@ -404,7 +419,7 @@ void ContentDirectoryService::doSamsungBookmark(ActionRequest& request) const
 {
     log_debug("start");
 
-    request.getQuirks()->saveSamsungBookMarkedPosition(database, request);
+    request.getQuirks()->saveSamsungBookMarkedPosition(database, browseCache, request);
 
     log_debug("end");
 }
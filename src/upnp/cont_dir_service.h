@@ -39,6 +39,7 @@
 #include <string>
 #include <vector>
 
+class BrowseResultCache;
 class CdsObject;
 class Context;
 class Database;
@@ -124,6 +125,8 @@ private:
     void markPlayedItem(const std::shared_ptr<CdsObject>& cdsObject, std::string title) const;
 
     std::shared_ptr<Database> database;
+    /// @brief rendered results of browse requests
+    std::shared_ptr<BrowseResultCache> browseCache;
 
     std::vector<std::string> titleSegments;
     std::string resultSeparator;
@@ -134,7 +137,8 @@ public:
     /// in internal variables.
     explicit ContentDirectoryService(const std::shared_ptr<Context>& context,
         const std::shared_ptr<UpnpXMLBuilder>& xmlBuilder,
-        UpnpDevice_Handle deviceHandle, int stringLimit, bool offline);
+        UpnpDevice_Handle deviceHandle, int stringLimit, bool offline,
+        std::shared_ptr<BrowseResultCache> browseCache = nullptr);
 
     /// @brief Processes an incoming SubscriptionRequest.
     /// @param request SubscriptionRequest to be processed by the function.
@@ -0,0 +1,160 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    didl_writer.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file upnp/didl_writer.cc
+#define GRB_LOG_FAC GrbLogFacility::xml
+
+#include "didl_writer.h" // API
+
+#include "upnp/quirks.h"
+#include "upnp/upnp_common.h"
+#include "upnp/xml_builder.h"
+#include "util/logger.h"
+
+/// @brief estimated size of an escaped object in DIDL-Lite
+static constexpr std::size_t DIDL_OBJECT_SIZE = 1024;
+/// @brief empty result element as printed by pugixml
+static constexpr std::string_view EMPTY_RESULT = "<Result />";
+
+/// @brief escape text for a pcdata node the same way pugixml does
+static void appendEscaped(std::string& output, std::string_view text)
+{
+    for (auto&& c : text) {
+        switch (c) {
+        case '&':
+            output.append("&amp;");
+            break;
+        case '<':
+            output.append("&lt;");
+            break;
+        case '>':
+            output.append("&gt;");
+            break;
+        default: {
+            auto ch = static_cast<unsigned char>(c);
+            if (ch < 32 && ch != '\t' && ch != '\n' && ch != '\r') {
+                output.append("&#");
+                output.push_back(static_cast<char>('0' + ch / 10));
+                output.push_back(static_cast<char>('0' + ch % 10));
+                output.push_back(';');
+            } else {
+                output.push_back(c);
+            }
+        }
+        }
+    }
+}
+
+/// @brief pugixml writer escaping everything into a string
+class EscapingWriter : public pugi::xml_writer {
+public:
+    explicit EscapingWriter(std::string& output)
+        : output(output)
+    {
+    }
+
+    void write(const void* data, std::size_t size) override
+    {
+        appendEscaped(output, std::string_view(static_cast<const char*>(data), size));
+    }
+
+private:
+    std::string& output;
+};
+
+DidlWriter::DidlWriter(std::shared_ptr<UpnpXMLBuilder> xmlBuilder, const std::shared_ptr<Quirks>& quirks, std::size_t count)
+    : xmlBuilder(std::move(xmlBuilder))
+    , flags(quirks && quirks->hasFlag(Quirk::StrictXML) ? pugi::format_no_escapes : 0)
+    , namespaces {
+        { UPNP_XML_DIDL_LITE_NAMESPACE_ATTR, UPNP_XML_DIDL_LITE_NAMESPACE },
+        { UPNP_XML_DC_NAMESPACE_ATTR, UPNP_XML_DC_NAMESPACE },
+        { UPNP_XML_UPNP_NAMESPACE_ATTR, UPNP_XML_UPNP_NAMESPACE },
+        { UPNP_XML_SEC_NAMESPACE_ATTR, UPNP_XML_SEC_NAMESPACE },
+    }
+{
+    output.reserve((count + 1) * DIDL_OBJECT_SIZE);
+    if (!quirks || !quirks->hasFlag(Quirk::NoXmlDeclaration))
+        appendEscaped(output, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    scratchRoot = scratch.append_child("DIDL-Lite");
+}
+
+void DidlWriter::addNamespace(const std::string& name, const std::string& value)
+{
+    namespaces.emplace_back(name, value);
+}
+
+void DidlWriter::openRoot()
+{
+    if (rootOpen)
+        return;
+    // attribute values are constants without characters to escape
+    std::string root = "<DIDL-Lite";
+    for (auto&& [name, value] : namespaces)
+        root.append(fmt::format(" {}=\"{}\"", name, value));
+    appendEscaped(output, root);
+    rootOpen = true;
+}
+
+void DidlWriter::renderObject(
+    const std::shared_ptr<CdsObject>& obj,
+    const std::vector<std::string>& filter,
+    std::size_t stringLimit,
+    const std::shared_ptr<Quirks>& quirks)
+{
+    if (!rootOpen) {
+        openRoot();
+        appendEscaped(output, ">\n");
+    }
+
+    xmlBuilder->renderObject(obj, filter, stringLimit, scratchRoot, quirks);
+    EscapingWriter writer(output);
+    for (auto&& node : scratchRoot.children())
+        node.print(writer, "", flags, pugi::encoding_auto, 1);
+    while (scratchRoot.first_child())
+        scratchRoot.remove_child(scratchRoot.first_child());
+}
+
+std::string DidlWriter::finish()
+{
+    if (!rootOpen) {
+        openRoot();
+        appendEscaped(output, " />\n");
+    } else {
+        appendEscaped(output, "</DIDL-Lite>\n");
+    }
+    return std::move(output);
+}
+
+std::string DidlWriter::printResponse(const pugi::xml_node& response, std::string_view result)
+{
+    auto xml = UpnpXMLBuilder::printXml(response, "", 0);
+    auto pos = xml.find(EMPTY_RESULT);
+    if (pos == std::string::npos) {
+        log_warning("Response has no Result element");
+        return xml;
+    }
+    std::string output;
+    output.reserve(xml.size() + result.size() + 10);
+    output.append(xml, 0, pos).append("<Result>").append(result).append("</Result>").append(xml, pos + EMPTY_RESULT.size());
+    return output;
+}
@@ -0,0 +1,82 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    didl_writer.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file upnp/didl_writer.h
+/// @brief Definition of the DidlWriter class.
+
+#ifndef __UPNP_DIDL_WRITER_H__
+#define __UPNP_DIDL_WRITER_H__
+
+#include <memory>
+#include <pugixml.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CdsObject;
+class Quirks;
+class UpnpXMLBuilder;
+
+/// @brief Writes the DIDL-Lite result of browse and search into a string that can be placed in the SOAP response
+///
+/// Each object is rendered with UpnpXMLBuilder::renderObject into a small scratch document and printed
+/// right away, so the full result never exists as DOM. The output is escaped for the Result element while
+/// it is written, so the response document does not copy and escape it again.
+class DidlWriter {
+public:
+    /// @brief prepare writer
+    /// @param xmlBuilder builder rendering the objects
+    /// @param quirks client quirks for declaration and escaping
+    /// @param count expected number of objects to reserve output buffer
+    DidlWriter(std::shared_ptr<UpnpXMLBuilder> xmlBuilder, const std::shared_ptr<Quirks>& quirks, std::size_t count);
+
+    /// @brief add attribute to DIDL-Lite element, only allowed before first object
+    void addNamespace(const std::string& name, const std::string& value);
+    /// @brief render object into the output, see UpnpXMLBuilder::renderObject
+    void renderObject(
+        const std::shared_ptr<CdsObject>& obj,
+        const std::vector<std::string>& filter,
+        std::size_t stringLimit,
+        const std::shared_ptr<Quirks>& quirks = nullptr);
+    /// @brief close DIDL-Lite element and return escaped result
+    std::string finish();
+
+    /// @brief print action response and insert escaped result into its empty Result element
+    static std::string printResponse(const pugi::xml_node& response, std::string_view result);
+
+private:
+    /// @brief append DIDL-Lite start tag if not done yet
+    void openRoot();
+
+    std::shared_ptr<UpnpXMLBuilder> xmlBuilder;
+    /// @brief pugi flags for printing the objects
+    unsigned int flags;
+    std::vector<std::pair<std::string, std::string>> namespaces;
+    bool rootOpen { false };
+    std::string output;
+    /// @brief holds the object currently rendered
+    pugi::xml_document scratch;
+    pugi::xml_node scratchRoot;
+};
+
+#endif // __UPNP_DIDL_WRITER_H__
@@ -31,6 +31,7 @@
 #include "cds/cds_item.h"
 #include "config/result/client_config.h"
 #include "database/database.h"
+#include "upnp/browse_result_cache.h"
 #include "upnp/client_manager.h"
 #include "upnp/clients.h"
 #include "upnp/headers.h"
@@ -340,7 +341,7 @@ void Quirks::restoreSamsungBookMarkedPosition(const std::shared_ptr<CdsItem>& it
     result.append_child("sec:dcmInfo").append_child(pugi::node_pcdata).set_value(dcmInfo.c_str());
 }
 
-void Quirks::saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& database, ActionRequest& request) const
+void Quirks::saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& database, const std::shared_ptr<BrowseResultCache>& browseCache, ActionRequest& request) const
 {
     if (!hasFlag(Quirk::SamsungBookmarkSeconds) && !hasFlag(Quirk::SamsungBookmarkMilliSeconds)) {
         log_debug("X_SetBookmark called, but it is not enabled for this client");
@@ -355,19 +356,8 @@ void Quirks::saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& data
             [[maybe_unused]] auto categoryType = reqRoot.child_value("CategoryType");
             [[maybe_unused]] auto rID = reqRoot.child_value("RID");
 
-            if (hasFlag(Quirk::SamsungBookmarkSeconds))
-                bookMarkPos *= 1000;
-
-            log_debug("X_SetBookmark: ObjectID [{}] CategoryType [{}] RID [{}] BookMarkPos [{}] msec", objectID, categoryType, rID, bookMarkPos);
-
-            auto playStatus = database->getPlayStatus(pClientProfile->group, objectID);
-            if (!playStatus)
-                playStatus = std::make_shared<ClientStatusDetail>(pClientProfile->group, objectID, 1, 0, 0, bookMarkPos);
-            else {
-                playStatus->setLastPlayed();
-                playStatus->setBookMarkPosition(bookMarkPos);
-            }
-            database->savePlayStatus(playStatus);
+            log_debug("X_SetBookmark: ObjectID [{}] CategoryType [{}] RID [{}] PosSecond [{}]", objectID, categoryType, rID, bookMarkPos);
+            saveSamsungBookMark(database, browseCache, objectID, bookMarkPos);
         } else {
             log_warning("X_SetBookmark called without correct content");
         }
@@ -376,6 +366,25 @@ void Quirks::saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& data
     request.setResponse(std::move(response));
 }
 
+void Quirks::saveSamsungBookMark(const std::shared_ptr<Database>& database, const std::shared_ptr<BrowseResultCache>& browseCache, int objectID, int bookMarkPos) const
+{
+    if (hasFlag(Quirk::SamsungBookmarkSeconds))
+        bookMarkPos *= 1000;
+
+    auto playStatus = database->getPlayStatus(pClientProfile->group, objectID);
+    if (!playStatus)
+        playStatus = std::make_shared<ClientStatusDetail>(pClientProfile->group, objectID, 1, 0, 0, bookMarkPos);
+    else {
+        playStatus->setLastPlayed();
+        playStatus->setBookMarkPosition(bookMarkPos);
+    }
+    database->savePlayStatus(playStatus);
+
+    // sec:dcmInfo is rendered into every page that returned the object
+    if (browseCache)
+        browseCache->invalidate({ objectID });
+}
+
 bool Quirks::supportsResource(ResourcePurpose purpose) const
 {
     return pClientProfile ? std::find(pClientProfile->supportedResources.begin(), pClientProfile->supportedResources.end(), purpose) != pClientProfile->supportedResources.end() : true;
@@ -68,6 +68,7 @@ enum class Quirk {
 
 // forward declaration
 class ActionRequest;
+class BrowseResultCache;
 class ClientManager;
 class Context;
 class CdsItem;
@@ -111,11 +112,23 @@ public:
     /** @brief Stored bookmark information into the database
      *
      * @param database storage to retrieve position from
+     * @param browseCache cached browse results that contain the bookmark
      * @param request request sent by Samsung client, which holds the position information which should be stored
      * @return void
      *
      */
-    void saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& database, ActionRequest& request) const;
+    void saveSamsungBookMarkedPosition(const std::shared_ptr<Database>& database, const std::shared_ptr<BrowseResultCache>& browseCache, ActionRequest& request) const;
+
+    /** @brief Store bookmark of object and drop cached browse results rendered with the old one
+     *
+     * @param database storage to save position to
+     * @param browseCache cached browse results that contain the bookmark
+     * @param objectID object played by the client
+     * @param bookMarkPos position as sent by the client
+     * @return void
+     *
+     */
+    void saveSamsungBookMark(const std::shared_ptr<Database>& database, const std::shared_ptr<BrowseResultCache>& browseCache, int objectID, int bookMarkPos) const;
 
     /** @brief get UPnP shortcut List
      *
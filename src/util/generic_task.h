@@ -34,6 +34,9 @@
 #ifndef __GENERIC_TASK_H__
 #define __GENERIC_TASK_H__
 
+#include "util/grb_fs.h"
+
+#include <atomic>
 #include <string>
 
 /// @brief Type of tasks
@@ -59,7 +62,7 @@ protected:
     TaskOwner taskOwner;
     unsigned int parentTaskID {};
     unsigned int taskID {};
-    bool valid { true };
+    std::atomic_bool valid { true };
     bool cancellable { true };
 
 public:
@@ -80,6 +83,8 @@ public:
     bool isValid() const { return valid; }
     bool isCancellable() const { return cancellable; }
     void invalidate() { valid = false; }
+    /// @brief directory the task works on, a task without directory does not run next to other tasks
+    virtual fs::path getScope() const { return {}; }
 };
 
 #endif //__GENERIC_TASK_H__
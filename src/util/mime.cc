@@ -87,7 +87,9 @@ std::string Mime::fileToMimeType(const fs::path& path, const std::string& defval
 
 std::string Mime::bufferToMimeType(const void* buffer, std::size_t length)
 {
-    return magic_buffer(magicCookie, buffer, length);
+    auto lock = std::scoped_lock(mime_mutex);
+    const char* mimeType = magic_buffer(magicCookie, buffer, length);
+    return mimeType ? mimeType : "";
 }
 #endif
 
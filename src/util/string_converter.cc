@@ -121,6 +121,7 @@ std::pair<std::string, std::string> StringConverter::_convert(
     bool validate,
     std::size_t* stoppedAt)
 {
+    auto lock = std::scoped_lock(convMutex);
     // reset to initial state
     if (dirty) {
         iconv(cd, nullptr, nullptr, nullptr, nullptr);
@@ -257,6 +258,7 @@ ConverterManager::~ConverterManager() = default;
 
 const std::shared_ptr<StringConverter>& ConverterManager::m2i(ConfigVal option, const fs::path& location)
 {
+    auto lock = ConverterAutoLock(converterMutex);
     auto charset = charsets.at(option);
     if (charset.empty()) {
         charset = config->getOption(ConfigVal::IMPORT_METADATA_CHARSET);
@@ -274,12 +276,14 @@ const std::shared_ptr<StringConverter>& ConverterManager::m2i(ConfigVal option,
 
 const std::shared_ptr<StringConverter>& ConverterManager::f2i() const
 {
+    auto lock = ConverterAutoLock(converterMutex);
     return converters.at(charsets.at(ConfigVal::IMPORT_FILESYSTEM_CHARSET));
 }
 
 #if defined(HAVE_JS) || defined(HAVE_CURL) || defined(HAVE_TAGLIB) || defined(HAVE_MATROSKA)
 const std::shared_ptr<StringConverter>& ConverterManager::i2i() const
 {
+    auto lock = ConverterAutoLock(converterMutex);
     return converters.at(charsets.at(ConfigVal::MAX));
 }
 #endif
@@ -287,11 +291,13 @@ const std::shared_ptr<StringConverter>& ConverterManager::i2i() const
 #ifdef HAVE_JS
 const std::shared_ptr<StringConverter>& ConverterManager::j2i() const
 {
+    auto lock = ConverterAutoLock(converterMutex);
     return converters.at(charsets.at(ConfigVal::IMPORT_SCRIPTING_CHARSET));
 }
 
 const std::shared_ptr<StringConverter>& ConverterManager::p2i() const
 {
+    auto lock = ConverterAutoLock(converterMutex);
     return converters.at(charsets.at(ConfigVal::IMPORT_PLAYLIST_CHARSET));
 }
 #endif
@@ -39,6 +39,7 @@
 #include <iconv.h>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 class Config;
@@ -70,6 +71,8 @@ protected:
     iconv_t cd;
     bool dirty {};
     std::string to;
+    /// @brief iconv descriptors keep conversion state and must not be shared between threads
+    std::mutex convMutex;
 
     std::pair<std::string, std::string> _convert(
         const std::string& str,
@@ -106,6 +109,8 @@ protected:
     std::shared_ptr<Config> config;
     std::map<ConfigVal, std::string> charsets;
     std::map<std::string, std::shared_ptr<StringConverter>> converters;
+    mutable std::mutex converterMutex;
+    using ConverterAutoLock = std::scoped_lock<decltype(converterMutex)>;
 };
 
 #endif // __STRING_CONVERTER_H__
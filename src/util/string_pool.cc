@@ -0,0 +1,95 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    string_pool.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file util/string_pool.cc
+#define GRB_LOG_FAC GrbLogFacility::content
+#include "string_pool.h" // API
+
+#include "util/logger.h"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+/// @brief owned strings, keys point into them so lookups need no allocation
+using StringPool = std::unordered_map<std::string_view, std::unique_ptr<std::string>>;
+
+static StringPool& getPool()
+{
+    // never destroyed so objects released during shutdown keep valid strings
+    static auto pool = new StringPool();
+    return *pool;
+}
+
+static std::shared_mutex& getPoolMutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+/// @brief find or add string in pool, nullptr if the pool is full
+static const std::string* intern(std::string_view str)
+{
+    auto&& pool = getPool();
+    {
+        std::shared_lock lock(getPoolMutex());
+        auto entry = pool.find(str);
+        if (entry != pool.end())
+            return entry->second.get();
+    }
+    std::unique_lock lock(getPoolMutex());
+    auto entry = pool.find(str);
+    if (entry != pool.end())
+        return entry->second.get();
+    if (pool.size() >= InternedString::MAX_POOL_SIZE) {
+        static std::once_flag fullFlag;
+        std::call_once(fullFlag, [] { log_debug("String pool is full, storing further values per object"); });
+        return nullptr;
+    }
+    auto value = std::make_unique<std::string>(str);
+    auto result = value.get();
+    pool.emplace(*result, std::move(value));
+    return result;
+}
+
+InternedString::InternedString()
+{
+    static const std::string* emptyString = intern({});
+    value = emptyString;
+}
+
+InternedString::InternedString(std::string_view str)
+    : value(intern(str))
+{
+    if (!value) {
+        owned = std::make_shared<const std::string>(str);
+        value = owned.get();
+    }
+}
+
+std::size_t InternedString::poolSize()
+{
+    std::shared_lock lock(getPoolMutex());
+    return getPool().size();
+}
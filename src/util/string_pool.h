@@ -0,0 +1,73 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    string_pool.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// @file util/string_pool.h
+/// @brief Definition of the InternedString class.
+
+#ifndef __UTIL_STRING_POOL_H__
+#define __UTIL_STRING_POOL_H__
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+/// @brief Immutable string that is stored only once for the whole process
+///
+/// Used for values that repeat in many objects like upnp classes and mime types.
+/// Pooled strings are never released. Once the pool is full, new values are kept
+/// by the handle and its copies, so the pool cannot grow without limit.
+/// References from str() are only valid as long as the handle, getters of owners return copies.
+class InternedString {
+public:
+    InternedString();
+    InternedString(std::string_view str);
+    InternedString(const std::string& str)
+        : InternedString(std::string_view(str))
+    {
+    }
+    InternedString(const char* str)
+        : InternedString(std::string_view(str))
+    {
+    }
+
+    const std::string& str() const { return *value; }
+    operator const std::string&() const { return *value; }
+    bool empty() const { return value->empty(); }
+
+    bool operator==(const InternedString& other) const { return value == other.value || ((owned || other.owned) && *value == *other.value); }
+    bool operator!=(const InternedString& other) const { return !(*this == other); }
+    bool operator==(const std::string& other) const { return *value == other; }
+    bool operator!=(const std::string& other) const { return *value != other; }
+
+    /// @brief number of distinct strings in the pool
+    static std::size_t poolSize();
+    /// @brief maximum number of distinct strings in the pool
+    static constexpr std::size_t MAX_POOL_SIZE = 10000;
+
+private:
+    const std::string* value;
+    /// @brief storage of values that did not fit into the pool
+    std::shared_ptr<const std::string> owned;
+};
+
+#endif // __UTIL_STRING_POOL_H__
@@ -285,6 +285,10 @@ void Web::ConfigLoad::writeDatabaseStatus(Json::Value& values)
             addValue(values, fmt::format("/status/attribute::{}Bytes", attr), ConfigVal::MAX, ConfigVal::MAX, totalSize);
         }
     }
+
+    for (auto&& [key, value] : database->getDriverStats()) {
+        addValue(values, fmt::format("/status/attribute::{}", key), ConfigVal::MAX, ConfigVal::MAX, value);
+    }
 }
 
 /// @brief write upnp shortcuts
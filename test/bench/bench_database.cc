@@ -0,0 +1,150 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    bench_database.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file bench_database.cc
+
+#include "bench_library.h"
+
+#include "cds/cds_container.h"
+#include "cds/cds_item.h"
+#include "database/database.h"
+#include "database/db_param.h"
+#include "upnp/upnp_common.h"
+
+/// @brief number of objects requested per page like a typical renderer
+static constexpr int BENCH_PAGE_SIZE = 50;
+/// @brief flags of a BrowseDirectChildren request
+static constexpr unsigned int BENCH_BROWSE_FLAGS = BROWSE_DIRECT_CHILDREN | BROWSE_ITEMS | BROWSE_CONTAINERS | BROWSE_EXACT_CHILDCOUNT;
+
+static void BM_BrowseAlbum(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    std::size_t index = 0;
+    for (auto _ : state) {
+        auto albumId = library->albumIds.at(index++ % library->albumIds.size());
+        auto param = BrowseParam(library->database->loadObject(albumId), BENCH_BROWSE_FLAGS | BROWSE_TRACK_SORT);
+        benchmark::DoNotOptimize(library->database->browse(param));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BrowseAlbum)->Apply(BenchEnvironment::librarySizes);
+
+static void BM_BrowseArtistsPaged(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    auto root = library->database->loadObject(library->rootId);
+    auto pages = std::max<std::size_t>(1, library->artistIds.size() / BENCH_PAGE_SIZE);
+    std::size_t page = 0;
+    for (auto _ : state) {
+        auto param = BrowseParam(root, BENCH_BROWSE_FLAGS);
+        param.setSortCriteria("+dc:title");
+        param.setRange(static_cast<int>((page++ % pages) * BENCH_PAGE_SIZE), BENCH_PAGE_SIZE);
+        benchmark::DoNotOptimize(library->database->browse(param));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BrowseArtistsPaged)->Apply(BenchEnvironment::librarySizes);
+
+static void BM_SearchRoot(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    for (auto _ : state) {
+        auto param = SearchParam("0", R"(upnp:class derivedfrom "object.item.audioItem" and dc:title contains "Track 3")",
+            "+dc:title", 0, BENCH_PAGE_SIZE, true, DEFAULT_CLIENT_GROUP);
+        benchmark::DoNotOptimize(library->database->search(param));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SearchRoot)->Apply(BenchEnvironment::librarySizes);
+
+/// @brief search below an artist, resolved by recursive query or closure table
+template <bool closure>
+static void BM_SearchScoped(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0), closure);
+    std::size_t index = 0;
+    for (auto _ : state) {
+        auto artistId = library->artistIds.at(index++ % library->artistIds.size());
+        auto param = SearchParam(fmt::to_string(artistId), R"(upnp:class derivedfrom "object.item.audioItem")",
+            "+dc:title", 0, BENCH_PAGE_SIZE, true, DEFAULT_CLIENT_GROUP);
+        benchmark::DoNotOptimize(library->database->search(param));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_SearchScoped, false)->Apply(BenchEnvironment::librarySizes);
+BENCHMARK_TEMPLATE(BM_SearchScoped, true)->Apply(BenchEnvironment::librarySizes);
+
+static void BM_GetChildCounts(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    // child counts of one page of albums as requested while rendering a browse result
+    auto pages = std::max<std::size_t>(1, library->albumIds.size() / BENCH_PAGE_SIZE);
+    std::size_t page = 0;
+    for (auto _ : state) {
+        auto start = library->albumIds.begin() + (page++ % pages) * BENCH_PAGE_SIZE;
+        auto end = start + std::min<std::ptrdiff_t>(BENCH_PAGE_SIZE, library->albumIds.end() - start);
+        benchmark::DoNotOptimize(library->database->getChildCounts(std::vector<int>(start, end)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetChildCounts)->Apply(BenchEnvironment::librarySizes);
+
+static void BM_FindObjectByPath(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    std::size_t index = 0;
+    for (auto _ : state) {
+        auto&& path = library->itemPaths.at(index++ % library->itemPaths.size());
+        benchmark::DoNotOptimize(library->database->findObjectByPath(path, UNUSED_CLIENT_GROUP, DbFileType::File));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindObjectByPath)->Apply(BenchEnvironment::librarySizes);
+
+/// @brief add an album with its tracks and remove it again
+static void BM_AddRemoveAlbum(benchmark::State& state)
+{
+    auto library = BenchEnvironment::get().getLibrary(state.range(0));
+    auto&& database = library->database;
+    std::size_t index = 0;
+    for (auto _ : state) {
+        auto albumPath = fs::path("/bench/added") / fmt::format("Album {}", index++);
+        int albumId = INVALID_OBJECT_ID;
+        database->addContainer(library->rootId, albumPath.string(), std::make_shared<CdsContainer>(albumPath.filename().string(), UPNP_CLASS_MUSIC_ALBUM, CdsEntryType::Directory), &albumId);
+
+        std::vector<std::shared_ptr<CdsObject>> tracks;
+        for (std::size_t track = 0; track < BENCH_FANOUT; track++) {
+            auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+            item->setParentID(albumId);
+            item->setLocation(albumPath / fmt::format("{:02} - Track.mp3", track + 1), CdsEntryType::File);
+            item->setTitle(fmt::format("Track {}", track + 1));
+            item->setClass(UPNP_CLASS_MUSIC_TRACK);
+            item->setMimeType("audio/mpeg");
+            tracks.push_back(item);
+        }
+        database->addObjects(tracks, nullptr);
+        benchmark::DoNotOptimize(database->removeObjects({ albumId }, true));
+    }
+    state.SetItemsProcessed(state.iterations() * (BENCH_FANOUT + 1));
+}
+BENCHMARK(BM_AddRemoveAlbum)->Apply(BenchEnvironment::librarySizes);
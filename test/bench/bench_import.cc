@@ -0,0 +1,126 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    bench_import.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file bench_import.cc
+
+#include "bench_library.h"
+
+#include "cds/cds_objects.h"
+#include "config/config.h"
+#include "config/config_val.h"
+#include "content/autoscan_setting.h"
+#include "content/content_manager.h"
+#include "content/import_service.h"
+#include "context.h"
+#include "database/database.h"
+
+#include <unordered_set>
+
+/// @brief Import service on its own database, without virtual layout by default
+class BenchImport {
+public:
+    BenchImport(const std::string& name, const fs::path& location, LayoutType layoutType = LayoutType::Disabled)
+        : location(location)
+    {
+        auto&& environment = BenchEnvironment::get();
+        auto config = environment.getConfig();
+        database = environment.createDatabase(name);
+        auto context = environment.createContext(database);
+        content = std::make_shared<ContentManager>(context, nullptr, nullptr);
+        importService = std::make_shared<ImportService>(context, context->getConverterManager());
+        importService->run(content);
+        if (layoutType != LayoutType::Disabled)
+            importService->initLayout(layoutType);
+
+        settings.recursive = true;
+        settings.async = false;
+        settings.followSymlinks = config->getBoolOption(ConfigVal::IMPORT_FOLLOW_SYMLINKS);
+        settings.hidden = config->getBoolOption(ConfigVal::IMPORT_HIDDEN_FILES);
+        settings.mergeOptions(config, location);
+    }
+
+    void doImport()
+    {
+        std::unordered_set<int> currentContent;
+        importService->doImport(location, settings, currentContent, nullptr);
+    }
+
+    /// @brief remove imported objects so the next import starts from an empty tree
+    void clear()
+    {
+        auto root = database->findObjectByPath(location, UNUSED_CLIENT_GROUP, DbFileType::Directory);
+        if (root)
+            database->removeObjects({ root->getID() }, true);
+        importService->clearCache();
+    }
+
+private:
+    fs::path location;
+    AutoScanSetting settings;
+    std::shared_ptr<Database> database;
+    std::shared_ptr<ContentManager> content;
+    std::shared_ptr<ImportService> importService;
+};
+
+static void BM_ImportInitial(benchmark::State& state)
+{
+    auto tree = BenchEnvironment::get().getTree(state.range(0));
+    BenchImport import(fmt::format("import-{}.db", state.range(0)), tree);
+    for (auto _ : state) {
+        state.PauseTiming();
+        import.clear();
+        state.ResumeTiming();
+        import.doImport();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ImportInitial)->Apply(BenchEnvironment::librarySizes)->Unit(benchmark::kMillisecond);
+
+/// @brief scan of an unchanged tree like a manual or timed autoscan
+static void BM_ImportRescan(benchmark::State& state)
+{
+    auto tree = BenchEnvironment::get().getTree(state.range(0));
+    BenchImport import(fmt::format("rescan-{}.db", state.range(0)), tree);
+    import.doImport();
+    for (auto _ : state)
+        import.doImport();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ImportRescan)->Apply(BenchEnvironment::librarySizes)->Unit(benchmark::kMillisecond);
+
+#ifdef HAVE_JS
+/// @brief initial import with the shipped layout scripts, virtual containers exist after the first run
+static void BM_ImportScriptLayout(benchmark::State& state)
+{
+    auto tree = BenchEnvironment::get().getTree(state.range(0));
+    BenchImport import(fmt::format("script-{}.db", state.range(0)), tree, LayoutType::Js);
+    for (auto _ : state) {
+        state.PauseTiming();
+        import.clear();
+        state.ResumeTiming();
+        import.doImport();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ImportScriptLayout)->Apply(BenchEnvironment::librarySizes)->Unit(benchmark::kMillisecond);
+#endif
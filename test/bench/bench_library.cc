@@ -0,0 +1,225 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    bench_library.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file bench_library.cc
+
+#include "bench_library.h"
+
+#include "cds/cds_container.h"
+#include "cds/cds_item.h"
+#include "cds/cds_resource.h"
+#include "config/config_definition.h"
+#include "config/config_generator.h"
+#include "config/config_manager.h"
+#include "config/config_options.h"
+#include "config/config_val.h"
+#include "context.h"
+#include "database/database.h"
+#include "database/sqlite3/sqlite_database.h"
+#include "upnp/upnp_common.h"
+#include "util/mime.h"
+#include "util/string_converter.h"
+#include "util/tools.h"
+
+#include <array>
+#include <cstdlib>
+#include <fstream>
+
+/// @brief library sizes used when GERBERA_BENCH_SIZES is not set
+static constexpr auto DEFAULT_SIZES = "1000,10000";
+
+BenchEnvironment& BenchEnvironment::get()
+{
+    static BenchEnvironment environment;
+    return environment;
+}
+
+void BenchEnvironment::librarySizes(benchmark::internal::Benchmark* bench)
+{
+    auto sizes = std::getenv("GERBERA_BENCH_SIZES");
+    bench->ArgName("items");
+    for (auto&& size : splitString(sizes ? sizes : DEFAULT_SIZES, ','))
+        bench->Arg(stoiString(size));
+}
+
+BenchEnvironment::BenchEnvironment()
+    : workDir(fs::temp_directory_path() / fmt::format("gerbera-bench-{}", generateRandomId()))
+    , definition(std::make_shared<ConfigDefinition>())
+{
+    definition->init(definition);
+
+    fs::create_directories(workDir / "web");
+    fs::create_directories(workDir / "js");
+    fs::create_directories(workDir / ".config");
+
+    // empty scripts must exist for the configuration
+    auto mockFiles = std::array {
+        workDir / "js" / "common.js",
+        workDir / "js" / "import.js",
+        workDir / "js" / "playlists.js",
+        workDir / "js" / "metadata.js",
+    };
+    for (auto&& mFile : mockFiles)
+        std::ofstream(mFile).close();
+    for (auto&& sqlFile : { "sqlite3.sql", "sqlite3-drop.sql", "sqlite3-upgrade.xml" })
+        fs::copy_file(fs::path(SQLITE_SOURCE_DIR) / sqlFile, workDir / sqlFile);
+
+    auto configFile = workDir / ".config" / "config.xml";
+    {
+        ConfigGenerator configGenerator(definition, "gerbera-bench", ConfigLevel::Base);
+        std::ofstream file(configFile);
+        file << configGenerator.generate(workDir, ".config", workDir, "");
+    }
+
+    auto configManager = std::make_shared<ConfigManager>(definition, configFile, workDir, ".config", workDir, false);
+    configManager->load(workDir);
+    config = configManager;
+    config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_BACKUP_ENABLED, std::make_shared<BoolOption>(false));
+
+    mime = std::make_shared<Mime>(config);
+    converterManager = std::make_shared<ConverterManager>(config);
+#ifdef HAVE_JS
+    // benchmarks with virtual layout run the shipped scripts
+    config->addOption(ConfigVal::IMPORT_SCRIPTING_COMMON_FOLDER, std::make_shared<Option>(SCRIPTS_SOURCE_DIR));
+#endif
+}
+
+std::shared_ptr<Database> BenchEnvironment::createDatabase(const std::string& name, bool closure)
+{
+    config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE, std::make_shared<Option>((workDir / name).string()));
+    config->addOption(ConfigVal::SERVER_STORAGE_CONTAINER_CLOSURE, std::make_shared<BoolOption>(closure));
+
+    // same choice as Database::createInstance, without timer for backups
+    std::shared_ptr<Database> database;
+    if (config->getBoolOption(ConfigVal::SERVER_STORAGE_USE_TRANSACTIONS))
+        database = std::make_shared<Sqlite3DatabaseWithTransactions>(config, mime, converterManager, nullptr);
+    else
+        database = std::make_shared<Sqlite3Database>(config, mime, converterManager, nullptr);
+    database->run();
+    database->init();
+    databases.push_back(database);
+    return database;
+}
+
+std::shared_ptr<BenchLibrary> BenchEnvironment::getLibrary(std::size_t size, bool closure)
+{
+    auto entry = libraries.find({ size, closure });
+    if (entry != libraries.end())
+        return entry->second;
+
+    auto library = std::make_shared<BenchLibrary>();
+    library->database = createDatabase(fmt::format("library-{}{}.db", size, closure ? "-closure" : ""), closure);
+    fillLibrary(*library, size);
+    libraries[{ size, closure }] = library;
+    return library;
+}
+
+void BenchEnvironment::fillLibrary(BenchLibrary& library, std::size_t size) const
+{
+    auto&& database = library.database;
+    auto rootPath = fs::path("/bench");
+    database->addContainer(CDS_ID_FS_ROOT, rootPath.string(), std::make_shared<CdsContainer>("bench", UPNP_CLASS_CONTAINER, CdsEntryType::Directory), &library.rootId);
+
+    std::size_t itemCount = 0;
+    for (std::size_t artist = 0; itemCount < size; artist++) {
+        auto artistName = fmt::format("Artist {:04}", artist);
+        auto artistPath = rootPath / artistName;
+        int artistId = INVALID_OBJECT_ID;
+        database->addContainer(library.rootId, artistPath.string(), std::make_shared<CdsContainer>(artistName, UPNP_CLASS_MUSIC_ARTIST, CdsEntryType::Directory), &artistId);
+        library.artistIds.push_back(artistId);
+
+        for (std::size_t album = 0; album < BENCH_FANOUT && itemCount < size; album++) {
+            auto albumName = fmt::format("Album {:02}", album);
+            auto albumPath = artistPath / albumName;
+            int albumId = INVALID_OBJECT_ID;
+            database->addContainer(artistId, albumPath.string(), std::make_shared<CdsContainer>(albumName, UPNP_CLASS_MUSIC_ALBUM, CdsEntryType::Directory), &albumId);
+            library.albumIds.push_back(albumId);
+
+            std::vector<std::shared_ptr<CdsObject>> tracks;
+            for (std::size_t track = 0; track < BENCH_FANOUT && itemCount < size; track++, itemCount++) {
+                auto title = fmt::format("Track {} of {}", track + 1, artistName);
+                auto location = albumPath / fmt::format("{:02} - {}.mp3", track + 1, title);
+                auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+                item->setParentID(albumId);
+                item->setLocation(location, CdsEntryType::File);
+                item->setTitle(title);
+                item->setClass(UPNP_CLASS_MUSIC_TRACK);
+                item->setMimeType("audio/mpeg");
+                item->setTrackNumber(static_cast<int>(track) + 1);
+                item->addMetaData(MetadataFields::M_TITLE, title);
+                item->addMetaData(MetadataFields::M_ARTIST, artistName);
+                item->addMetaData(MetadataFields::M_ALBUM, albumName);
+                item->addMetaData(MetadataFields::M_GENRE, fmt::format("Genre {}", artist % BENCH_FANOUT));
+                item->addMetaData(MetadataFields::M_UPNP_DATE, "2024-01-01");
+
+                auto resource = std::make_shared<CdsResource>(ContentHandler::DEFAULT, ResourcePurpose::Content);
+                resource->addAttribute(ResourceAttribute::PROTOCOLINFO, renderProtocolInfo("audio/mpeg"));
+                resource->addAttribute(ResourceAttribute::SIZE, "4711000");
+                resource->addAttribute(ResourceAttribute::DURATION, "0:03:25.000");
+                resource->addAttribute(ResourceAttribute::BITRATE, "40000");
+                item->addResource(resource);
+
+                library.itemPaths.push_back(location);
+                tracks.push_back(item);
+            }
+            database->addObjects(tracks, nullptr);
+        }
+    }
+}
+
+fs::path BenchEnvironment::getTree(std::size_t size)
+{
+    auto entry = trees.find(size);
+    if (entry != trees.end())
+        return entry->second;
+
+    auto treePath = workDir / fmt::format("tree-{}", size);
+    std::size_t itemCount = 0;
+    for (std::size_t artist = 0; itemCount < size; artist++) {
+        for (std::size_t album = 0; album < BENCH_FANOUT && itemCount < size; album++) {
+            auto albumPath = treePath / fmt::format("Artist {:04}", artist) / fmt::format("Album {:02}", album);
+            fs::create_directories(albumPath);
+            for (std::size_t track = 0; track < BENCH_FANOUT && itemCount < size; track++, itemCount++)
+                std::ofstream(albumPath / fmt::format("{:02} - Track.flv", track + 1)).close();
+        }
+    }
+    trees[size] = treePath;
+    return treePath;
+}
+
+std::shared_ptr<Context> BenchEnvironment::createContext(const std::shared_ptr<Database>& database) const
+{
+    return std::make_shared<Context>(definition, config, nullptr, mime, database, nullptr, converterManager);
+}
+
+void BenchEnvironment::cleanup()
+{
+    for (auto&& database : databases)
+        database->shutdown();
+    libraries.clear();
+    databases.clear();
+    trees.clear();
+
+    std::error_code ec;
+    fs::remove_all(workDir, ec);
+}
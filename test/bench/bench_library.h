@@ -0,0 +1,95 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    bench_library.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file bench_library.h
+/// @brief Definition of the BenchEnvironment class.
+
+#ifndef __BENCH_LIBRARY_H__
+#define __BENCH_LIBRARY_H__
+
+#include "util/grb_fs.h"
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+class Config;
+class ConfigDefinition;
+class ConverterManager;
+class Context;
+class Database;
+class Mime;
+
+/// @brief number of albums per artist and tracks per album in generated libraries
+static constexpr std::size_t BENCH_FANOUT = 10;
+
+/// @brief Synthetic library in its own SQLite database
+struct BenchLibrary {
+    std::shared_ptr<Database> database;
+    int rootId {};
+    std::vector<int> artistIds;
+    std::vector<int> albumIds;
+    /// @brief locations of all items
+    std::vector<fs::path> itemPaths;
+};
+
+/// @brief Shared setup of all benchmarks
+///
+/// Creates a working directory with a generated default configuration. Libraries are generated
+/// on first use and kept until the end of the run, so each size is only written once.
+class BenchEnvironment {
+public:
+    static BenchEnvironment& get();
+
+    /// @brief register library sizes from GERBERA_BENCH_SIZES as benchmark arguments
+    static void librarySizes(benchmark::internal::Benchmark* bench);
+
+    /// @brief get library with size items, generated on first use
+    std::shared_ptr<BenchLibrary> getLibrary(std::size_t size, bool closure = false);
+    /// @brief create empty database file name in working directory
+    std::shared_ptr<Database> createDatabase(const std::string& name, bool closure = false);
+    /// @brief create directory tree with size empty media files, created on first use
+    fs::path getTree(std::size_t size);
+    std::shared_ptr<Context> createContext(const std::shared_ptr<Database>& database) const;
+
+    std::shared_ptr<Config> getConfig() const { return config; }
+
+    /// @brief shut down all databases and remove working directory
+    void cleanup();
+
+private:
+    BenchEnvironment();
+    void fillLibrary(BenchLibrary& library, std::size_t size) const;
+
+    fs::path workDir;
+    std::shared_ptr<ConfigDefinition> definition;
+    std::shared_ptr<Config> config;
+    std::shared_ptr<Mime> mime;
+    std::shared_ptr<ConverterManager> converterManager;
+    std::map<std::pair<std::size_t, bool>, std::shared_ptr<BenchLibrary>> libraries;
+    std::vector<std::shared_ptr<Database>> databases;
+    std::map<std::size_t, fs::path> trees;
+};
+
+#endif // __BENCH_LIBRARY_H__
@@ -0,0 +1,85 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    bench_upnp.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file bench_upnp.cc
+
+#include "bench_library.h"
+
+#include "cds/cds_objects.h"
+#include "config/config.h"
+#include "config/config_val.h"
+#include "database/database.h"
+#include "database/db_param.h"
+#include "upnp/didl_writer.h"
+#include "upnp/xml_builder.h"
+
+#include <pugixml.hpp>
+
+/// @brief objects of the first albums, rendered in each iteration
+static std::vector<std::shared_ptr<CdsObject>> loadPage(const std::shared_ptr<BenchLibrary>& library)
+{
+    std::vector<std::shared_ptr<CdsObject>> page;
+    for (std::size_t index = 0; index < std::min<std::size_t>(5, library->albumIds.size()); index++) {
+        auto param = BrowseParam(library->database->loadObject(library->albumIds.at(index)), BROWSE_DIRECT_CHILDREN | BROWSE_ITEMS | BROWSE_CONTAINERS);
+        auto objects = library->database->browse(param);
+        page.insert(page.end(), objects.begin(), objects.end());
+    }
+    return page;
+}
+
+static void BM_RenderObject(benchmark::State& state)
+{
+    auto&& environment = BenchEnvironment::get();
+    auto library = environment.getLibrary(state.range(0));
+    auto xmlBuilder = std::make_shared<UpnpXMLBuilder>(environment.createContext(library->database), "http://127.0.0.1:49152/");
+    auto stringLimit = environment.getConfig()->getIntOption(ConfigVal::SERVER_UPNP_TITLE_AND_DESC_STRING_LIMIT);
+    auto filter = std::vector<std::string> { "*" };
+    auto page = loadPage(library);
+    for (auto _ : state) {
+        pugi::xml_document didlLite;
+        auto root = didlLite.append_child("DIDL-Lite");
+        for (auto&& obj : page)
+            xmlBuilder->renderObject(obj, filter, stringLimit, root);
+        benchmark::DoNotOptimize(UpnpXMLBuilder::printXml(didlLite, "", 0));
+    }
+    state.SetItemsProcessed(state.iterations() * page.size());
+}
+BENCHMARK(BM_RenderObject)->Apply(BenchEnvironment::librarySizes);
+
+static void BM_DidlWriter(benchmark::State& state)
+{
+    auto&& environment = BenchEnvironment::get();
+    auto library = environment.getLibrary(state.range(0));
+    auto xmlBuilder = std::make_shared<UpnpXMLBuilder>(environment.createContext(library->database), "http://127.0.0.1:49152/");
+    auto stringLimit = environment.getConfig()->getIntOption(ConfigVal::SERVER_UPNP_TITLE_AND_DESC_STRING_LIMIT);
+    auto filter = std::vector<std::string> { "*" };
+    auto page = loadPage(library);
+    for (auto _ : state) {
+        DidlWriter didlLite(xmlBuilder, nullptr, page.size());
+        for (auto&& obj : page)
+            didlLite.renderObject(obj, filter, stringLimit);
+        benchmark::DoNotOptimize(didlLite.finish());
+    }
+    state.SetItemsProcessed(state.iterations() * page.size());
+}
+BENCHMARK(BM_DidlWriter)->Apply(BenchEnvironment::librarySizes);
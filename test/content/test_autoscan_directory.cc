@@ -0,0 +1,93 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_autoscan_directory.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "config/result/autoscan.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+
+class AutoscanDirectoryTest : public ::testing::Test {
+public:
+    void SetUp() override
+    {
+        dir = fs::temp_directory_path() / "grb_autoscan_directory_test";
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        adir = std::make_shared<AutoscanDirectory>();
+        adir->setLocation(dir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    void addFile(const std::string& name)
+    {
+        std::ofstream(dir / name) << name;
+    }
+
+protected:
+    fs::path dir;
+    std::shared_ptr<AutoscanDirectory> adir;
+};
+
+TEST_F(AutoscanDirectoryTest, UnknownDirIsChanged)
+{
+    EXPECT_FALSE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+
+    adir->setDirModified(dir, fs::last_write_time(dir));
+    EXPECT_TRUE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+
+    adir->resetLMT();
+    EXPECT_FALSE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+}
+
+TEST_F(AutoscanDirectoryTest, FileAddedInSameSecond)
+{
+    // start of a second, so the file is added within the same second
+    auto scanned = std::chrono::time_point_cast<std::chrono::seconds>(fs::last_write_time(dir)) + std::chrono::milliseconds(100);
+    fs::last_write_time(dir, scanned);
+    addFile("first.mp3");
+    fs::last_write_time(dir / "first.mp3", scanned);
+    fs::last_write_time(dir, scanned);
+    adir->setDirModified(dir, fs::last_write_time(dir));
+
+    addFile("second.mp3");
+    fs::last_write_time(dir, scanned + std::chrono::milliseconds(200));
+    EXPECT_FALSE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+}
+
+TEST_F(AutoscanDirectoryTest, FutureModificationTime)
+{
+    addFile("future.mp3");
+    auto future = fs::last_write_time(dir) + std::chrono::hours(24);
+    fs::last_write_time(dir / "future.mp3", future);
+    fs::last_write_time(dir, future);
+    adir->setDirModified(dir, fs::last_write_time(dir));
+    EXPECT_TRUE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+
+    // adding a file sets the current time which is before the recorded one
+    addFile("now.mp3");
+    EXPECT_FALSE(adir->isUnchangedDir(dir, fs::last_write_time(dir)));
+}
@@ -0,0 +1,136 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_layout_batch.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "cds/cds_item.h"
+#include "content/layout/layout.h"
+#include "exceptions.h"
+#include "upnp/upnp_common.h"
+
+#include <gtest/gtest.h>
+
+/// @brief layout that records the processed items and fails batches or single items on request
+class RecordingLayout : public Layout {
+public:
+    RecordingLayout()
+        : Layout(nullptr)
+    {
+    }
+
+    void processCdsObjects(
+        std::vector<LayoutItem>& items,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override
+    {
+        batches++;
+        if (failBatch)
+            throw_std_runtime_error("broken batch");
+        Layout::processCdsObjects(items, rootpath, containerMap);
+    }
+
+    std::size_t batches {};
+    bool failBatch {};
+    std::string failTitle;
+    std::vector<std::string> added;
+
+protected:
+    std::vector<int> addVideo(
+        const std::shared_ptr<CdsObject>& obj,
+        const std::shared_ptr<CdsContainer>& parent,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override
+    {
+        if (obj->getTitle() == failTitle)
+            throw_std_runtime_error("broken item {}", obj->getTitle());
+        added.push_back(obj->getTitle());
+        return {};
+    }
+    std::vector<int> addImage(
+        const std::shared_ptr<CdsObject>& obj,
+        const std::shared_ptr<CdsContainer>& parent,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override
+    {
+        return addVideo(obj, parent, rootpath, containerMap);
+    }
+    std::vector<int> addAudio(
+        const std::shared_ptr<CdsObject>& obj,
+        const std::shared_ptr<CdsContainer>& parent,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override
+    {
+        return addVideo(obj, parent, rootpath, containerMap);
+    }
+#ifdef ONLINE_SERVICES
+    std::vector<int> addOnlineItem(
+        const std::shared_ptr<CdsObject>& obj,
+        OnlineServiceType serviceType,
+        const fs::path& rootpath,
+        const std::map<AutoscanMediaMode, std::string>& containerMap) override
+    {
+        return addVideo(obj, nullptr, rootpath, containerMap);
+    }
+#endif
+};
+
+class LayoutBatchTest : public ::testing::Test {
+public:
+    void SetUp() override
+    {
+        for (auto&& title : { "first", "second", "third" }) {
+            auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+            item->setTitle(title);
+            item->setClass(UPNP_CLASS_VIDEO_ITEM);
+            items.push_back({ item, nullptr, "", {} });
+        }
+    }
+
+    RecordingLayout layout;
+    std::vector<Layout::LayoutItem> items;
+    std::map<AutoscanMediaMode, std::string> containerMap;
+};
+
+TEST_F(LayoutBatchTest, ProcessesBatchOnce)
+{
+    layout.processBatch(items, "/media", containerMap);
+
+    EXPECT_EQ(layout.batches, 1);
+    EXPECT_EQ(layout.added, std::vector<std::string>({ "first", "second", "third" }));
+}
+
+TEST_F(LayoutBatchTest, FailingBatchProcessesItemsOneByOne)
+{
+    layout.failBatch = true;
+    layout.processBatch(items, "/media", containerMap);
+
+    EXPECT_EQ(layout.batches, 1);
+    EXPECT_EQ(layout.added, std::vector<std::string>({ "first", "second", "third" }));
+}
+
+TEST_F(LayoutBatchTest, FailingItemDoesNotStopOtherItems)
+{
+    layout.failBatch = true;
+    layout.failTitle = "second";
+    layout.processBatch(items, "/media", containerMap);
+
+    EXPECT_EQ(layout.added, std::vector<std::string>({ "first", "third" }));
+}
@@ -0,0 +1,61 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_layout_mapping.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+
+#include "content/layout_mapping.h"
+
+#include <gtest/gtest.h>
+
+TEST(LayoutMappingTest, detectsLiteralKeys)
+{
+    EXPECT_TRUE(LayoutMapping::isLiteral("/Audio/Genres", "/Music/Genres"));
+    EXPECT_FALSE(LayoutMapping::isLiteral("", "/Music"));
+    EXPECT_FALSE(LayoutMapping::isLiteral("^/Audio", "/Music"));
+    EXPECT_FALSE(LayoutMapping::isLiteral("/Audio/.*", "/Music"));
+    EXPECT_FALSE(LayoutMapping::isLiteral("/Audio", "$&/Music"));
+}
+
+TEST(LayoutMappingTest, replacesLikeRegex)
+{
+    auto mapping = std::map<std::string, std::string> {
+        { "/Audio/All Audio", "/Music/All" },
+        { "Audio", "Music" },
+        { "/Video/(.*)", "/Movies/$1" },
+        { "aa", "a" },
+    };
+    LayoutMapping subject(mapping);
+
+    for (auto&& path : { "/Audio/All Audio", "/Audio/Audio/Artists", "/Video/Directories/aaaa", "/Photos" }) {
+        std::string expected = path;
+        for (auto&& [key, val] : mapping)
+            expected = std::regex_replace(expected, std::regex(key), val);
+        EXPECT_EQ(subject.apply(path), expected) << path;
+    }
+    EXPECT_EQ(subject.apply("/Audio/Audio/Artists"), "/Music/Music/Artists");
+}
+
+TEST(LayoutMappingTest, skipsInvalidRegex)
+{
+    LayoutMapping subject({ { "/Audio(", "/Music" }, { "/Video", "/Movies" } });
+    EXPECT_EQ(subject.apply("/Video/Audio("), "/Movies/Audio(");
+}
@@ -0,0 +1,116 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_path_index.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "cds/cds_item.h"
+#include "config/config_setup.h"
+#include "content/path_index.h"
+#include "upnp/clients.h"
+#include "upnp/upnp_common.h"
+
+#include "../mock/database_mock.h"
+
+#include <gtest/gtest.h>
+
+class PathDatabaseMock : public DatabaseMock {
+public:
+    PathDatabaseMock()
+        : DatabaseMock(nullptr)
+    {
+    }
+
+    std::vector<std::pair<fs::path, DbPathEntry>> getPathEntries(const fs::path& path) override
+    {
+        return {
+            { "/media", { 10, 1, INVALID_OBJECT_ID, OBJECT_TYPE_CONTAINER, CdsEntryType::Directory, UPNP_CLASS_CONTAINER, std::chrono::seconds(100) } },
+            { "/media/a.mp3", { 11, 10, INVALID_OBJECT_ID, OBJECT_TYPE_ITEM, CdsEntryType::File, UPNP_CLASS_MUSIC_TRACK, std::chrono::seconds(200) } },
+            { "/media/b.mp3", { 20, 30, 12, OBJECT_TYPE_ITEM, CdsEntryType::File, UPNP_CLASS_MUSIC_TRACK, std::chrono::seconds(300) } },
+            { "/media/b.mp3", { 12, 10, INVALID_OBJECT_ID, OBJECT_TYPE_ITEM, CdsEntryType::File, UPNP_CLASS_MUSIC_TRACK, std::chrono::seconds(300) } },
+            { "/media/b.mp3", { 21, 31, 12, OBJECT_TYPE_ITEM, CdsEntryType::File, UPNP_CLASS_MUSIC_TRACK, std::chrono::seconds(300) } },
+        };
+    }
+};
+
+class PathIndexTest : public ::testing::Test {
+public:
+    void SetUp() override
+    {
+        database = std::make_shared<PathDatabaseMock>();
+        subject.load(database, "/media");
+    }
+
+    std::shared_ptr<PathDatabaseMock> database;
+    PathIndex subject;
+};
+
+TEST_F(PathIndexTest, coversOnlyLoadedRoot)
+{
+    EXPECT_TRUE(subject.covers("/media"));
+    EXPECT_TRUE(subject.covers("/media/sub/c.mp3"));
+    EXPECT_FALSE(subject.covers("/media2/c.mp3"));
+    EXPECT_FALSE(subject.covers("/other"));
+
+    subject.clear();
+    EXPECT_FALSE(subject.covers("/media/a.mp3"));
+}
+
+TEST_F(PathIndexTest, findsEntries)
+{
+    EXPECT_EQ(subject.size(), 3);
+
+    auto entry = subject.find("/media/a.mp3");
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(entry->id, 11);
+    EXPECT_EQ(entry->mtime, std::chrono::seconds(200));
+
+    EXPECT_FALSE(subject.find("/media/c.mp3"));
+}
+
+TEST_F(PathIndexTest, prefersObjectWithoutReference)
+{
+    auto entry = subject.find("/media/b.mp3");
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(entry->id, 12);
+}
+
+TEST_F(PathIndexTest, addAndRemove)
+{
+    auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+    item->setID(13);
+    item->setParentID(10);
+    item->setLocation("/media/c.mp3", CdsEntryType::File);
+    item->setMTime(std::chrono::seconds(400));
+    subject.add(item);
+
+    auto entry = subject.find("/media/c.mp3");
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(entry->id, 13);
+
+    auto object = PathIndex::createObject("/media/c.mp3", entry.value());
+    EXPECT_TRUE(object->isItem());
+    EXPECT_EQ(object->getID(), 13);
+    EXPECT_EQ(object->getParentID(), 10);
+    EXPECT_EQ(object->getMTime(), std::chrono::seconds(400));
+
+    subject.remove("/media/c.mp3");
+    EXPECT_FALSE(subject.find("/media/c.mp3"));
+}
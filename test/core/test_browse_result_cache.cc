@@ -0,0 +1,132 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_browse_result_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_browse_result_cache.cc
+#include "upnp/browse_result_cache.h"
+
+#include "cds/cds_container.h"
+#include "cds/cds_item.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+TEST(BrowseResultCacheTest, CountsHitsAndMisses)
+{
+    BrowseResultCache cache(64 * 1024);
+    EXPECT_TRUE(cache.isEnabled());
+    EXPECT_FALSE(cache.get("client|7|1"));
+    cache.set("client|7|1", { 7 }, BrowseResult { "&lt;DIDL-Lite /&gt;", 0, 0 }, cache.getGeneration());
+    EXPECT_FALSE(cache.get("client|7|2"));
+
+    auto found = cache.get("client|7|1");
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->result, "&lt;DIDL-Lite /&gt;");
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(cache.getMisses(), 2);
+}
+
+TEST(BrowseResultCacheTest, InvalidatesChangedContainers)
+{
+    BrowseResultCache cache(64 * 1024);
+    cache.set("a", { 7 }, BrowseResult { "seven", 1, 1 }, cache.getGeneration());
+    cache.set("b", { 7 }, BrowseResult { "seven again", 1, 1 }, cache.getGeneration());
+    cache.set("c", { 8 }, BrowseResult { "eight", 1, 1 }, cache.getGeneration());
+
+    cache.invalidate({ 7, 9 });
+    EXPECT_FALSE(cache.get("a"));
+    EXPECT_FALSE(cache.get("b"));
+    EXPECT_TRUE(cache.get("c"));
+    EXPECT_EQ(cache.size(), 1);
+
+    cache.set("a", { 7 }, BrowseResult { "seven", 1, 1 }, cache.getGeneration());
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.getMemory(), 0);
+}
+
+TEST(BrowseResultCacheTest, EvictsLeastRecentlyUsedByMemory)
+{
+    auto result = BrowseResult { std::string(1000, 'x'), 10, 10 };
+    BrowseResultCache cache(3000);
+    cache.set("a", { 1 }, result, cache.getGeneration());
+    cache.set("b", { 2 }, result, cache.getGeneration());
+    EXPECT_TRUE(cache.get("a"));
+    cache.set("c", { 3 }, result, cache.getGeneration());
+
+    EXPECT_TRUE(cache.get("a"));
+    EXPECT_FALSE(cache.get("b"));
+    EXPECT_TRUE(cache.get("c"));
+    EXPECT_LE(cache.getMemory(), 3000);
+
+    // entry too large for the cache
+    cache.set("d", { 4 }, BrowseResult { std::string(3000, 'x'), 10, 10 }, cache.getGeneration());
+    EXPECT_FALSE(cache.get("d"));
+}
+
+TEST(BrowseResultCacheTest, InvalidatesParentOnChildChange)
+{
+    auto child = std::make_shared<CdsContainer>("Album");
+    child->setID(11);
+    child->setChildCount(1);
+    auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+    item->setID(12);
+    auto children = std::vector<std::shared_ptr<CdsObject>> { child, item };
+    BrowseResultCache cache(64 * 1024);
+
+    auto render = [&child]() { return BrowseResult { fmt::format("childCount={}", child->getChildCount()), 2, 2 }; };
+    auto browse = [&]() {
+        auto cached = cache.get("parent");
+        if (cached)
+            return cached->result;
+        auto generation = cache.getGeneration();
+        auto result = render();
+        cache.set("parent", BrowseResultCache::getDependencies(10, children), result, generation);
+        return result.result;
+    };
+
+    EXPECT_EQ(browse(), "childCount=1");
+    EXPECT_EQ(browse(), "childCount=1");
+    EXPECT_EQ(cache.getHits(), 1);
+
+    // adding an item to the child container only signals the child
+    child->setChildCount(2);
+    cache.invalidate({ child->getID() });
+    EXPECT_EQ(browse(), "childCount=2");
+
+    // changed metadata of returned item
+    cache.invalidate({ item->getID() });
+    EXPECT_FALSE(cache.get("parent"));
+}
+
+TEST(BrowseResultCacheTest, DropsResultRenderedDuringChange)
+{
+    BrowseResultCache cache(64 * 1024);
+    auto generation = cache.getGeneration();
+    // child 11 changes after the database was read and before the result is stored
+    cache.invalidate({ 11 });
+    cache.set("parent", { 10, 11 }, BrowseResult { "old child", 1, 1 }, generation);
+    EXPECT_FALSE(cache.get("parent"));
+
+    cache.set("parent", { 10, 11 }, BrowseResult { "new child", 1, 1 }, cache.getGeneration());
+    EXPECT_EQ(cache.get("parent")->result, "new child");
+}
@@ -0,0 +1,121 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_content_task_queue.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "content/content_task_queue.h"
+#include "util/generic_task.h"
+
+#include <gtest/gtest.h>
+
+class ScopeTask : public GenericTask {
+public:
+    explicit ScopeTask(fs::path scope)
+        : GenericTask(TaskOwner::ContentManagerTask)
+        , scope(std::move(scope))
+    {
+    }
+    void run() override { }
+    fs::path getScope() const override { return scope; }
+
+private:
+    fs::path scope;
+};
+
+class ContentTaskQueueTest : public ::testing::Test {
+protected:
+    std::shared_ptr<GenericTask> push(const fs::path& scope, bool lowPriority = false)
+    {
+        auto task = std::make_shared<ScopeTask>(scope);
+        queue.push(task, lowPriority);
+        return task;
+    }
+
+    ContentTaskQueue queue;
+};
+
+TEST_F(ContentTaskQueueTest, KeepsOrderInScope)
+{
+    auto first = push("/media/music");
+    auto second = push("/media/music");
+
+    EXPECT_EQ(queue.start(), first);
+    EXPECT_EQ(queue.start(), nullptr);
+    queue.finish(first);
+    EXPECT_EQ(queue.start(), second);
+    EXPECT_EQ(queue.getRunning().size(), 1);
+}
+
+TEST_F(ContentTaskQueueTest, RunsDisjointScopes)
+{
+    auto music = push("/media/music");
+    auto music2 = push("/media/music");
+    auto video = push("/media/video");
+
+    EXPECT_EQ(queue.start(), music);
+    EXPECT_EQ(queue.start(), video);
+    EXPECT_EQ(queue.start(), nullptr);
+    EXPECT_EQ(queue.getRunning().size(), 2);
+    EXPECT_EQ(queue.getQueue(false).front(), music2);
+}
+
+TEST_F(ContentTaskQueueTest, NestedScopesConflict)
+{
+    auto parent = push("/media");
+    auto child = push("/media/music");
+    auto other = push("/data");
+
+    EXPECT_EQ(queue.start(), parent);
+    EXPECT_EQ(queue.start(), other);
+    EXPECT_EQ(queue.start(), nullptr);
+    queue.finish(parent);
+    EXPECT_EQ(queue.start(), child);
+}
+
+TEST_F(ContentTaskQueueTest, TaskWithoutScopeRunsAlone)
+{
+    auto music = push("/media/music");
+    auto global = push("");
+    auto video = push("/media/video");
+
+    EXPECT_EQ(queue.start(), music);
+    // later tasks must not overtake the global task
+    EXPECT_EQ(queue.start(), nullptr);
+    queue.finish(music);
+    EXPECT_EQ(queue.start(), global);
+    EXPECT_EQ(queue.start(), nullptr);
+    queue.finish(global);
+    EXPECT_EQ(queue.start(), video);
+}
+
+TEST_F(ContentTaskQueueTest, PrefersHighPriority)
+{
+    auto low = push("/media/music", true);
+    auto lowOther = push("/media/video", true);
+    auto high = push("/media/music");
+
+    EXPECT_EQ(queue.start(), high);
+    // low priority task of same scope waits, other scope can run
+    EXPECT_EQ(queue.start(), lowOther);
+    EXPECT_EQ(queue.start(), nullptr);
+    queue.finish(high);
+    EXPECT_EQ(queue.start(), low);
+}
@@ -0,0 +1,108 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_read_ahead_io_handler.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "iohandler/file_io_handler.h"
+#include "iohandler/read_ahead_io_handler.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <vector>
+
+class ReadAheadIOHandlerTest : public ::testing::Test {
+public:
+    void SetUp() override
+    {
+        path = fs::temp_directory_path() / "grb_read_ahead_io_handler_test.bin";
+        std::ofstream file(path, std::ios::binary);
+        // larger than several read ahead blocks
+        for (int i = 0; i < fileSize; i++)
+            file.put(static_cast<char>(i * 7));
+    }
+
+    void TearDown() override
+    {
+        fs::remove(path);
+    }
+
+    static std::vector<std::byte> readAll(IOHandler& handler, std::size_t chunk)
+    {
+        std::vector<std::byte> result;
+        std::vector<std::byte> buf(chunk);
+        grb_read_t count;
+        while ((count = handler.read(buf.data(), chunk)) > 0)
+            result.insert(result.end(), buf.begin(), buf.begin() + count);
+        return result;
+    }
+
+protected:
+    fs::path path;
+    static constexpr int fileSize = 40 * 1024 * 1024 + 123;
+};
+
+TEST_F(ReadAheadIOHandlerTest, ReadsSameDataAsFileIOHandler)
+{
+    FileIOHandler fileHandler(path);
+    ReadAheadIOHandler readAheadHandler(path);
+    fileHandler.open(UPNP_READ);
+    readAheadHandler.open(UPNP_READ);
+
+    fileHandler.seek(1000, SEEK_SET);
+    readAheadHandler.seek(1000, SEEK_SET);
+    EXPECT_EQ(fileHandler.tell(), readAheadHandler.tell());
+    EXPECT_EQ(readAll(fileHandler, 65536), readAll(readAheadHandler, 65536));
+    EXPECT_EQ(fileHandler.tell(), readAheadHandler.tell());
+
+    fileHandler.close();
+    readAheadHandler.close();
+}
+
+TEST_F(ReadAheadIOHandlerTest, SeekAndOffset)
+{
+    ReadAheadIOHandler handler(path, 33 * 1024 * 1024);
+    handler.open(UPNP_READ);
+    EXPECT_EQ(handler.tell(), 33 * 1024 * 1024);
+    EXPECT_EQ(readAll(handler, 4096).size(), fileSize - 33 * 1024 * 1024);
+
+    handler.seek(-10, SEEK_END);
+    EXPECT_EQ(readAll(handler, 100).size(), 10);
+    EXPECT_THROW(handler.seek(-1, SEEK_SET), std::runtime_error);
+    handler.close();
+}
+
+TEST_F(ReadAheadIOHandlerTest, ReadsTruncatedFile)
+{
+    ReadAheadIOHandler handler(path);
+    handler.open(UPNP_READ);
+    std::vector<std::byte> buf(4096);
+    EXPECT_EQ(handler.read(buf.data(), buf.size()), 4096);
+
+    // file is rewritten while streaming
+    fs::resize_file(path, 16 * 1024 * 1024 + 5);
+    handler.seek(16 * 1024 * 1024 - 4096, SEEK_SET);
+    EXPECT_EQ(readAll(handler, 65536).size(), 4096 + 5);
+    EXPECT_EQ(handler.read(buf.data(), buf.size()), GRB_READ_END);
+
+    handler.seek(0, SEEK_SET);
+    EXPECT_EQ(readAll(handler, 65536).size(), 16 * 1024 * 1024 + 5);
+    handler.close();
+}
@@ -318,10 +318,11 @@ public:
     void TearDown() override { }
 
     ::testing::AssertionResult executeSearchParserTest(const std::string& input,
-        const std::string& expectedOutput, const std::string& expectedRe = "")
+        const std::string& expectedOutput, const std::string& expectedRe = "", std::shared_ptr<FullTextIndex> fullText = nullptr)
     {
         try {
             DefaultSQLEmitter emitter(columnMapper, columnMapper, columnMapper, columnMapper);
+            emitter.setFullTextIndex(std::move(fullText));
             auto parser = SearchParser(emitter, input);
             auto rootNode = parser.parse();
             if (!rootNode)
@@ -450,6 +451,25 @@ TEST_F(ParserTest, SearchCriteriaUsingStartsWithOperator)
         "(_t_._property_name_='upnp:album' AND LOWER(_t_._property_value_) LIKE LOWER('Midnight%')) OR (_t_._property_name_='upnp:artist' AND LOWER(_t_._property_value_) LIKE LOWER('HEAVE%'))"));
 }
 
+TEST_F(ParserTest, SearchCriteriaUsingFullTextIndex)
+{
+    auto fullText = std::make_shared<FullTextIndex>(FullTextIndex { "_t_._id_", "_fts_", "rowid", "_property_value_" });
+
+    EXPECT_TRUE(executeSearchParserTest("upnp:album contains \"Midnight\"",
+        "(_t_._property_name_='upnp:album' AND _t_._id_ IN (SELECT rowid FROM _fts_ WHERE _property_value_ LIKE LOWER('%Midnight%')))", "", fullText));
+    EXPECT_TRUE(executeSearchParserTest("upnp:album startswith \"Midnight\"",
+        "(_t_._property_name_='upnp:album' AND _t_._id_ IN (SELECT rowid FROM _fts_ WHERE _property_value_ LIKE LOWER('Midnight%')))", "", fullText));
+
+    // too short for the index
+    EXPECT_TRUE(executeSearchParserTest("upnp:album contains \"Mi\"",
+        "(_t_._property_name_='upnp:album' AND LOWER(_t_._property_value_) LIKE LOWER('%Mi%'))", "", fullText));
+    // other operators and columns
+    EXPECT_TRUE(executeSearchParserTest("upnp:album doesnotcontain \"Midnight\"",
+        "(_t_._property_name_='upnp:album' AND LOWER(_t_._property_value_) NOT LIKE LOWER('%Midnight%'))", "", fullText));
+    EXPECT_TRUE(executeSearchParserTest("upnp:class derivedfrom \"object.item\"",
+        "(LOWER(_t_._upnp_class_) LIKE LOWER('object.item%'))", "", fullText));
+}
+
 TEST_F(ParserTest, SearchCriteriaUsingExistsOperator)
 {
     // (containsOpExpr)
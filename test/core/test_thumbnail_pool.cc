@@ -0,0 +1,160 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_thumbnail_pool.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "metadata/thumbnail_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+/// @brief generator that blocks until released
+class BlockingGenerator {
+public:
+    ThumbnailPool::Generator create(std::string name)
+    {
+        return [this, name]() -> ThumbnailPool::Thumbnail {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                started.push_back(name);
+                cond.notify_all();
+                cond.wait(lock, [this] { return released; });
+            }
+            calls++;
+            return std::vector<std::byte>(name.size(), std::byte { 1 });
+        };
+    }
+
+    void waitStarted(std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [this, count] { return started.size() >= count; });
+    }
+
+    void release()
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        released = true;
+        cond.notify_all();
+    }
+
+    std::vector<std::string> getStarted()
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        return started;
+    }
+
+    std::atomic_int calls = 0;
+
+private:
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<std::string> started;
+    bool released {};
+};
+
+TEST(ThumbnailPoolTest, identicalRequestsShareGeneration)
+{
+    ThumbnailPool pool(2, 10);
+    BlockingGenerator generator;
+
+    ThumbnailPool::Thumbnail first;
+    ThumbnailPool::Thumbnail second;
+    std::thread client1([&] { first = pool.get("/media/a.mp4", generator.create("a")); });
+    generator.waitStarted(1);
+
+    // generator of second request is dropped as soon as it joins the running one
+    auto token = std::make_shared<int>(0);
+    std::weak_ptr<int> tokenRef = token;
+    auto secondGenerator = [token = std::move(token), inner = generator.create("a")]() { return inner(); };
+    std::thread client2([&] { second = pool.get("/media/a.mp4", std::move(secondGenerator)); });
+
+    while (!tokenRef.expired())
+        std::this_thread::yield();
+    generator.release();
+    client1.join();
+    client2.join();
+
+    EXPECT_EQ(generator.calls, 1);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(first->size(), 1);
+    EXPECT_EQ(pool.size(), 0);
+}
+
+TEST(ThumbnailPoolTest, clientsRunBeforePrefetch)
+{
+    ThumbnailPool pool(1, 10);
+    BlockingGenerator generator;
+
+    // keep the only worker busy
+    EXPECT_TRUE(pool.prefetch("/media/a.mp4", generator.create("a")));
+    generator.waitStarted(1);
+    EXPECT_TRUE(pool.prefetch("/media/b.mp4", generator.create("b")));
+    EXPECT_FALSE(pool.prefetch("/media/b.mp4", generator.create("b")));
+
+    ThumbnailPool::Thumbnail result;
+    std::thread client([&] { result = pool.get("/media/c.mp4", generator.create("c")); });
+    while (pool.size() != 3)
+        std::this_thread::yield();
+    generator.release();
+    client.join();
+    while (pool.size() != 0)
+        std::this_thread::yield();
+
+    EXPECT_EQ(generator.getStarted(), (std::vector<std::string> { "a", "c", "b" }));
+    EXPECT_TRUE(result);
+}
+
+TEST(ThumbnailPoolTest, prefetchQueueIsBounded)
+{
+    ThumbnailPool pool(1, 1);
+    BlockingGenerator generator;
+
+    EXPECT_TRUE(pool.prefetch("/media/a.mp4", generator.create("a")));
+    generator.waitStarted(1);
+    EXPECT_TRUE(pool.prefetch("/media/b.mp4", generator.create("b")));
+    EXPECT_FALSE(pool.prefetch("/media/c.mp4", generator.create("c")));
+
+    generator.release();
+    while (pool.size() != 0)
+        std::this_thread::yield();
+    EXPECT_EQ(generator.calls, 2);
+}
+
+TEST(ThumbnailPoolTest, generatesInClientWithoutWorkers)
+{
+    ThumbnailPool pool(0, 10);
+    auto client = std::this_thread::get_id();
+    std::thread::id generatorThread;
+
+    EXPECT_FALSE(pool.prefetch("/media/a.mkv", [] { return ThumbnailPool::Thumbnail(); }));
+    auto result = pool.get("/media/a.mkv", [&generatorThread]() -> ThumbnailPool::Thumbnail {
+        generatorThread = std::this_thread::get_id();
+        return std::vector<std::byte>(1, std::byte { 1 });
+    });
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(generatorThread, client);
+    EXPECT_EQ(pool.size(), 0);
+}
@@ -30,8 +30,11 @@
 #include "config/result/transcoding.h"
 #include "context.h"
 #include "metadata/metadata_handler.h"
+#include "upnp/browse_result_cache.h"
 #include "upnp/headers.h"
 #include "upnp/client_manager.h"
+#include "upnp/didl_writer.h"
+#include "upnp/upnp_common.h"
 #include "upnp/xml_builder.h"
 #include "util/grb_net.h"
 #include "util/string_converter.h"
@@ -84,6 +87,13 @@ public:
     std::shared_ptr<ClientConfigList> list;
 };
 
+class PlayStatusDatabaseMock : public DatabaseMock {
+public:
+    using DatabaseMock::DatabaseMock;
+    void savePlayStatus(const std::shared_ptr<ClientStatusDetail>& detail) override { saved.push_back(detail); }
+    std::vector<std::shared_ptr<ClientStatusDetail>> saved;
+};
+
 class UpnpXmlTest : public ::testing::Test {
 
 public:
@@ -326,6 +336,30 @@ TEST_F(UpnpXmlTest, QuirksFlag)
     EXPECT_TRUE(quirk.hasFlag(ClientConfig::makeFlags("Transcoding2"), true));
 }
 
+TEST_F(UpnpXmlTest, SamsungBookmarkDropsCachedResults)
+{
+    auto playStatusDb = std::make_shared<PlayStatusDatabaseMock>(config);
+    auto browseCache = std::make_shared<BrowseResultCache>(64 * 1024);
+    browseCache->set("parent", { 10, 42 }, BrowseResult { "BM=0", 2, 2 }, browseCache->getGeneration());
+    browseCache->set("item", { 42 }, BrowseResult { "BM=0", 1, 1 }, browseCache->getGeneration());
+    browseCache->set("other", { 11, 43 }, BrowseResult { "BM=0", 2, 2 }, browseCache->getGeneration());
+
+    auto addr = std::make_shared<GrbNet>("192.168.99.100");
+    auto profile = ClientProfile();
+    profile.flags = ClientConfig::getFlags({ Quirk::SamsungBookmarkSeconds });
+    auto client = ClientObservation(addr, "", std::chrono::seconds(0), std::chrono::seconds(0), nullptr, &profile);
+    auto quirks = Quirks(&client);
+    quirks.saveSamsungBookMark(playStatusDb, browseCache, 42, 120);
+
+    ASSERT_EQ(playStatusDb->saved.size(), 1);
+    EXPECT_EQ(playStatusDb->saved.front()->getItemId(), 42);
+    EXPECT_EQ(playStatusDb->saved.front()->getBookMarkPosition(), std::chrono::seconds(120));
+    // pages returning the item are rendered again with the new bookmark
+    EXPECT_FALSE(browseCache->get("parent"));
+    EXPECT_FALSE(browseCache->get("item"));
+    EXPECT_TRUE(browseCache->get("other"));
+}
+
 TEST_F(UpnpXmlTest, RenderObjectItemWithStrictXmlQuirks)
 {
     // arrange
@@ -549,3 +583,78 @@ TEST_F(UpnpXmlTest, FirstResourceAddsLocalResourceIdToItem)
     EXPECT_NE(result, "");
     EXPECT_STREQ(result.c_str(), "http://server/media/object_id/12345/res_id/0");
 }
+
+/// @brief render objects as ContentDirectoryService did with a full DIDL-Lite document
+static std::string renderResponseDocument(const std::shared_ptr<UpnpXMLBuilder>& subject, const std::vector<std::shared_ptr<CdsObject>>& objects)
+{
+    pugi::xml_document didlLite;
+    auto decl = didlLite.prepend_child(pugi::node_declaration);
+    decl.append_attribute("version") = "1.0";
+    decl.append_attribute("encoding") = "UTF-8";
+    auto root = didlLite.append_child("DIDL-Lite");
+    root.append_attribute(UPNP_XML_DIDL_LITE_NAMESPACE_ATTR) = UPNP_XML_DIDL_LITE_NAMESPACE;
+    root.append_attribute(UPNP_XML_DC_NAMESPACE_ATTR) = UPNP_XML_DC_NAMESPACE;
+    root.append_attribute(UPNP_XML_UPNP_NAMESPACE_ATTR) = UPNP_XML_UPNP_NAMESPACE;
+    root.append_attribute(UPNP_XML_SEC_NAMESPACE_ATTR) = UPNP_XML_SEC_NAMESPACE;
+    for (auto&& obj : objects)
+        subject->renderObject(obj, { "*" }, std::string::npos, root);
+
+    auto response = subject->createResponse("Browse", UPNP_DESC_CDS_SERVICE_TYPE);
+    auto respRoot = response->document_element();
+    respRoot.append_child("Result").append_child(pugi::node_pcdata).set_value(UpnpXMLBuilder::printXml(didlLite, "", 0).c_str());
+    respRoot.append_child("NumberReturned").append_child(pugi::node_pcdata).set_value(fmt::to_string(objects.size()).c_str());
+    return UpnpXMLBuilder::printXml(*response, "", 0);
+}
+
+/// @brief render objects with DidlWriter
+static std::string renderResponseStream(const std::shared_ptr<UpnpXMLBuilder>& subject, const std::vector<std::shared_ptr<CdsObject>>& objects)
+{
+    auto didlLite = DidlWriter(subject, nullptr, objects.size());
+    for (auto&& obj : objects)
+        didlLite.renderObject(obj, { "*" }, std::string::npos);
+
+    auto response = subject->createResponse("Browse", UPNP_DESC_CDS_SERVICE_TYPE);
+    auto respRoot = response->document_element();
+    respRoot.append_child("Result");
+    respRoot.append_child("NumberReturned").append_child(pugi::node_pcdata).set_value(fmt::to_string(objects.size()).c_str());
+    return DidlWriter::printResponse(*response, didlLite.finish());
+}
+
+TEST_F(UpnpXmlTest, DidlWriterMatchesDocument)
+{
+    auto container = std::make_shared<CdsContainer>(CdsEntryType::Directory);
+    container->setID(1);
+    container->setParentID(0);
+    container->setTitle("Music & Video");
+    container->setClass(UPNP_CLASS_CONTAINER);
+
+    auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+    item->setID(2);
+    item->setParentID(1);
+    item->setRestricted(false);
+    item->setTitle("Title 'n <Ticks>");
+    item->setClass(UPNP_CLASS_MUSIC_TRACK);
+    item->addMetaData(MetadataFields::M_DESCRIPTION, "Description \"quoted\"\x01");
+    item->addMetaData(MetadataFields::M_ALBUM, "Album & Test");
+    item->addMetaData(MetadataFields::M_DATE, "2022-04-01T00:00:00");
+
+    EXPECT_CALL(*config, getOption(ConfigVal::IMPORT_LIBOPTS_ENTRY_SEP))
+        .WillRepeatedly(Return(" / "));
+    EXPECT_CALL(*config, getTranscodingProfileListOption(_))
+        .WillRepeatedly(Return(std::make_shared<TranscodingProfileList>()));
+
+    std::vector<std::shared_ptr<CdsObject>> objects { container, item, makeObjectWithRes() };
+    auto expected = renderResponseDocument(subject, objects);
+    auto actual = renderResponseStream(subject, objects);
+
+    EXPECT_NE(actual.find("&amp;lt;Ticks&amp;gt;"), std::string::npos);
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(UpnpXmlTest, DidlWriterMatchesEmptyDocument)
+{
+    auto expected = renderResponseDocument(subject, {});
+    auto actual = renderResponseStream(subject, {});
+
+    EXPECT_EQ(actual, expected);
+}
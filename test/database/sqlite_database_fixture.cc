@@ -0,0 +1,105 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    sqlite_database_fixture.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file sqlite_database_fixture.cc
+
+#include "sqlite_database_fixture.h"
+
+#include "config/config_definition.h"
+#include "config/config_generator.h"
+#include "config/config_manager.h"
+#include "config/config_options.h"
+#include "config/config_val.h"
+#include "database/database.h"
+#include "database/sqlite3/sqlite_database.h"
+#include "util/mime.h"
+#include "util/string_converter.h"
+#include "util/tools.h"
+
+#include <array>
+#include <fstream>
+
+void SqliteDatabaseFixture::SetUp()
+{
+    workDir = fs::temp_directory_path() / fmt::format("gerbera-test-{}", generateRandomId());
+    definition = std::make_shared<ConfigDefinition>();
+    definition->init(definition);
+
+    fs::create_directories(workDir / "web");
+    fs::create_directories(workDir / "js");
+    fs::create_directories(workDir / ".config");
+
+    // scripts are not used, but must exist for the configuration
+    auto mockFiles = std::array {
+        workDir / "js" / "common.js",
+        workDir / "js" / "import.js",
+        workDir / "js" / "playlists.js",
+        workDir / "js" / "metadata.js",
+    };
+    for (auto&& mFile : mockFiles)
+        std::ofstream(mFile).close();
+    // database scripts are copied to the test directory by the GrbDb fixtures
+    for (auto&& sqlFile : { SL_INIT_FILE, SL_DROP_FILE, "sqlite3-upgrade.xml" })
+        fs::copy_file(fs::current_path() / sqlFile, workDir / sqlFile);
+
+    auto configFile = workDir / ".config" / "config.xml";
+    {
+        ConfigGenerator configGenerator(definition, "gerbera-test", ConfigLevel::Base);
+        std::ofstream file(configFile);
+        file << configGenerator.generate(workDir, ".config", workDir, "");
+    }
+
+    auto configManager = std::make_shared<ConfigManager>(definition, configFile, workDir, ".config", workDir, false);
+    configManager->load(workDir);
+    config = configManager;
+    config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_BACKUP_ENABLED, std::make_shared<BoolOption>(false));
+
+    mime = std::make_shared<Mime>(config);
+    converterManager = std::make_shared<ConverterManager>(config);
+}
+
+void SqliteDatabaseFixture::TearDown()
+{
+    for (auto&& database : databases)
+        database->shutdown();
+    databases.clear();
+
+    std::error_code ec;
+    fs::remove_all(workDir, ec);
+}
+
+std::shared_ptr<Database> SqliteDatabaseFixture::createDatabase(const std::string& name)
+{
+    config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_DATABASE_FILE, std::make_shared<Option>((workDir / name).string()));
+
+    // same choice as Database::createInstance, without timer for backups
+    std::shared_ptr<Database> database;
+    if (config->getBoolOption(ConfigVal::SERVER_STORAGE_USE_TRANSACTIONS))
+        database = std::make_shared<Sqlite3DatabaseWithTransactions>(config, mime, converterManager, nullptr);
+    else
+        database = std::make_shared<Sqlite3Database>(config, mime, converterManager, nullptr);
+    database->run();
+    database->init();
+    databases.push_back(database);
+    return database;
+}
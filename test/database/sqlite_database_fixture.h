@@ -0,0 +1,62 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    sqlite_database_fixture.h - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file sqlite_database_fixture.h
+
+#ifndef GERBERA_SQLITE_DATABASE_FIXTURE_H
+#define GERBERA_SQLITE_DATABASE_FIXTURE_H
+
+#include "util/grb_fs.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+class Config;
+class ConfigDefinition;
+class ConverterManager;
+class Database;
+class Mime;
+
+/// @brief Provides real SQLite3 databases in a temporary directory
+///
+/// The configuration is generated with default values, tests change options
+/// with config->addOption before calling createDatabase.
+class SqliteDatabaseFixture : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+    /// @brief create and initialise empty database file name in working directory
+    std::shared_ptr<Database> createDatabase(const std::string& name);
+
+protected:
+    fs::path workDir;
+    std::shared_ptr<ConfigDefinition> definition;
+    std::shared_ptr<Config> config;
+    std::shared_ptr<Mime> mime;
+    std::shared_ptr<ConverterManager> converterManager;
+    std::vector<std::shared_ptr<Database>> databases;
+};
+
+#endif // GERBERA_SQLITE_DATABASE_FIXTURE_H
@@ -0,0 +1,69 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_browse_cursor.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_browse_cursor.cc
+#include "database/browse_cursor.h"
+
+#include <gtest/gtest.h>
+
+TEST(BrowseCursorCacheTest, ContinuesAtNextIndexOnly)
+{
+    BrowseCursorCache cache(10);
+    BrowseCursor cursor;
+    cursor.id = 42;
+    cursor.sortValue = "title";
+
+    EXPECT_FALSE(cache.get("client|7", 50));
+    cache.set("client|7", 50, cursor);
+    EXPECT_FALSE(cache.get("client|7", 100));
+    EXPECT_FALSE(cache.get("other|7", 50));
+
+    auto found = cache.get("client|7", 50);
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->id, 42);
+    EXPECT_EQ(found->sortValue, "title");
+    EXPECT_FALSE(found->upnpClass);
+
+    cursor.id = 43;
+    cache.set("client|7", 100, cursor);
+    EXPECT_FALSE(cache.get("client|7", 50));
+    EXPECT_EQ(cache.get("client|7", 100)->id, 43);
+}
+
+TEST(BrowseCursorCacheTest, EvictsLeastRecentlyUsed)
+{
+    BrowseCursorCache cache(2);
+    BrowseCursor cursor;
+    cache.set("a", 10, cursor);
+    cache.set("b", 10, cursor);
+    EXPECT_TRUE(cache.get("a", 10));
+    cache.set("c", 10, cursor);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.get("a", 10));
+    EXPECT_FALSE(cache.get("b", 10));
+    EXPECT_TRUE(cache.get("c", 10));
+
+    BrowseCursorCache disabled(0);
+    disabled.set("a", 10, cursor);
+    EXPECT_FALSE(disabled.get("a", 10));
+}
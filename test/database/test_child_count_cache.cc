@@ -0,0 +1,133 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_child_count_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_child_count_cache.cc
+#include "cds/cds_enums.h"
+#include "database/child_count_cache.h"
+
+#include <gtest/gtest.h>
+
+static ChildCountCache::Counts makeCounts(int containers, int items)
+{
+    ChildCountCache::Counts result;
+    result.containers = containers;
+    result.items = items;
+    result.total = containers + items;
+    return result;
+}
+
+TEST(ChildCountCacheTest, GetReturnsFilteredCounts)
+{
+    ChildCountCache cache(10);
+    int count = -1;
+    EXPECT_FALSE(cache.get(5, true, true, count));
+
+    cache.set(5, makeCounts(2, 3), cache.getGeneration());
+    EXPECT_TRUE(cache.get(5, true, true, count));
+    EXPECT_EQ(count, 5);
+    EXPECT_TRUE(cache.get(5, true, false, count));
+    EXPECT_EQ(count, 2);
+    EXPECT_TRUE(cache.get(5, false, true, count));
+    EXPECT_EQ(count, 3);
+}
+
+TEST(ChildCountCacheTest, ChangeUpdatesCountsAfterApply)
+{
+    ChildCountCache cache(10);
+    int count = -1;
+    cache.set(5, makeCounts(2, 3), cache.getGeneration());
+    {
+        ChildCountCache::Change change(&cache);
+        change.add(5, OBJECT_TYPE_ITEM, 1);
+        change.add(5, OBJECT_TYPE_CONTAINER, -1);
+        EXPECT_FALSE(cache.get(5, true, true, count));
+        change.apply();
+    }
+    EXPECT_TRUE(cache.get(5, true, true, count));
+    EXPECT_EQ(count, 5);
+    EXPECT_TRUE(cache.get(5, true, false, count));
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(cache.get(5, false, true, count));
+    EXPECT_EQ(count, 4);
+}
+
+TEST(ChildCountCacheTest, ChangeWithoutApplyDropsCounts)
+{
+    ChildCountCache cache(10);
+    int count = -1;
+    cache.set(5, makeCounts(2, 3), cache.getGeneration());
+    {
+        ChildCountCache::Change change(&cache);
+        change.add(5, OBJECT_TYPE_ITEM, 1);
+    }
+    EXPECT_FALSE(cache.get(5, true, true, count));
+
+    // container is no longer pending
+    cache.set(5, makeCounts(2, 4), cache.getGeneration());
+    EXPECT_TRUE(cache.get(5, true, true, count));
+    EXPECT_EQ(count, 6);
+}
+
+TEST(ChildCountCacheTest, SetIsRejectedDuringChange)
+{
+    ChildCountCache cache(10);
+    int count = -1;
+    auto generation = cache.getGeneration();
+
+    // a change started after the read
+    ChildCountCache::Change change(&cache);
+    change.add(7, OBJECT_TYPE_ITEM, 1);
+    cache.set(5, makeCounts(1, 1), generation);
+    EXPECT_FALSE(cache.get(5, true, true, count));
+
+    // a read started during the change
+    cache.set(7, makeCounts(0, 1), cache.getGeneration());
+    EXPECT_FALSE(cache.get(7, true, true, count));
+
+    change.apply();
+    cache.set(7, makeCounts(0, 2), cache.getGeneration());
+    EXPECT_TRUE(cache.get(7, true, true, count));
+    EXPECT_EQ(count, 2);
+}
+
+TEST(ChildCountCacheTest, EraseAndLimit)
+{
+    ChildCountCache cache(2);
+    int count = -1;
+    cache.set(1, makeCounts(1, 0), cache.getGeneration());
+    cache.set(2, makeCounts(2, 0), cache.getGeneration());
+    cache.set(3, makeCounts(3, 0), cache.getGeneration());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.get(3, true, true, count));
+    EXPECT_EQ(count, 3);
+
+    cache.erase(3);
+    EXPECT_FALSE(cache.get(3, true, true, count));
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+
+    ChildCountCache disabled(0);
+    EXPECT_FALSE(disabled.isEnabled());
+    disabled.set(1, makeCounts(1, 0), disabled.getGeneration());
+    EXPECT_FALSE(disabled.get(1, true, true, count));
+}
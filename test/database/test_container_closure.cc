@@ -0,0 +1,155 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_container_closure.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_container_closure.cc
+
+#include "cds/cds_container.h"
+#include "cds/cds_item.h"
+#include "config/config.h"
+#include "config/config_options.h"
+#include "config/config_val.h"
+#include "database/db_param.h"
+#include "database/sql_database.h"
+#include "database/sql_result.h"
+#include "database/sql_table.h"
+#include "upnp/upnp_common.h"
+
+#include "sqlite_database_fixture.h"
+
+class ContainerClosureTest : public SqliteDatabaseFixture {
+public:
+    void SetUp() override
+    {
+        SqliteDatabaseFixture::SetUp();
+        config->addOption(ConfigVal::SERVER_STORAGE_CONTAINER_CLOSURE, std::make_shared<BoolOption>(true));
+        database = createDatabase("closure.db");
+        sqlDatabase = std::dynamic_pointer_cast<SQLDatabase>(database);
+        ASSERT_NE(sqlDatabase, nullptr);
+    }
+
+    int addContainer(const std::string& title, int parentId)
+    {
+        auto container = std::make_shared<CdsContainer>(title);
+        container->setParentID(parentId);
+        database->addObject(container, nullptr);
+        return container->getID();
+    }
+
+    int addItem(const std::string& title, int parentId)
+    {
+        auto item = std::make_shared<CdsItem>(CdsEntryType::File);
+        item->setTitle(title);
+        item->setClass(UPNP_CLASS_MUSIC_TRACK);
+        item->setMimeType("audio/mpeg");
+        item->setLocation(fs::path("/music") / fmt::format("{}.mp3", title), CdsEntryType::File);
+        item->setParentID(parentId);
+        database->addObject(item, nullptr);
+        return item->getID();
+    }
+
+    void moveObject(int objectId, int parentId)
+    {
+        auto obj = database->loadObject(objectId);
+        obj->setParentID(parentId);
+        database->updateObject(obj, nullptr);
+    }
+
+    /// @brief ancestors of object including itself from closure table
+    std::vector<int> getAncestors(int objectId)
+    {
+        std::vector<int> result;
+        auto res = sqlDatabase->select(fmt::format(R"(SELECT "ancestor_id" FROM "{}" WHERE "descendant_id" = {} ORDER BY "ancestor_id")", CLOSURE_TABLE, objectId));
+        if (!res)
+            return result;
+        std::unique_ptr<SQLRow> row;
+        while ((row = res->nextRow()))
+            result.push_back(row->col_int(0, INVALID_OBJECT_ID));
+        return result;
+    }
+
+    /// @brief titles of items found by search below container
+    std::vector<std::string> searchItems(int containerId)
+    {
+        auto param = SearchParam(fmt::to_string(containerId), R"(upnp:class derivedfrom "object.item")", "", 0, 0, false, UNUSED_CLIENT_GROUP);
+        std::vector<std::string> result;
+        for (auto&& obj : database->search(param))
+            result.push_back(obj->getTitle());
+        return result;
+    }
+
+protected:
+    std::shared_ptr<Database> database;
+    std::shared_ptr<SQLDatabase> sqlDatabase;
+};
+
+TEST_F(ContainerClosureTest, InsertAddsAllAncestors)
+{
+    auto artist = addContainer("Artist", CDS_ID_ROOT);
+    auto album = addContainer("Album", artist);
+    auto song = addItem("Song", album);
+
+    // the null object above root is the ancestor of everything
+    EXPECT_EQ(getAncestors(artist), std::vector<int>({ -1, CDS_ID_ROOT, artist }));
+    EXPECT_EQ(getAncestors(album), std::vector<int>({ -1, CDS_ID_ROOT, artist, album }));
+    EXPECT_EQ(getAncestors(song), std::vector<int>({ -1, CDS_ID_ROOT, artist, album, song }));
+
+    EXPECT_EQ(searchItems(artist), std::vector<std::string>({ "Song" }));
+    EXPECT_EQ(searchItems(album), std::vector<std::string>({ "Song" }));
+}
+
+TEST_F(ContainerClosureTest, MoveReplacesAncestorsOfSubtree)
+{
+    auto artist = addContainer("Artist", CDS_ID_ROOT);
+    auto other = addContainer("Other", CDS_ID_ROOT);
+    auto album = addContainer("Album", artist);
+    auto song = addItem("Song", album);
+
+    moveObject(album, other);
+
+    EXPECT_EQ(getAncestors(album), std::vector<int>({ -1, CDS_ID_ROOT, other, album }));
+    EXPECT_EQ(getAncestors(song), std::vector<int>({ -1, CDS_ID_ROOT, other, album, song }));
+    EXPECT_TRUE(searchItems(artist).empty());
+    EXPECT_EQ(searchItems(other), std::vector<std::string>({ "Song" }));
+}
+
+TEST_F(ContainerClosureTest, DeleteCascadesToSubtree)
+{
+    auto artist = addContainer("Artist", CDS_ID_ROOT);
+    auto album = addContainer("Album", artist);
+    auto song = addItem("Song", album);
+    auto other = addItem("Other", artist);
+
+    database->removeObject(album, {}, false);
+
+    EXPECT_TRUE(getAncestors(album).empty());
+    EXPECT_TRUE(getAncestors(song).empty());
+    // rows of the subtree are gone, not only the rows of the removed object
+    auto res = sqlDatabase->select(fmt::format(R"(SELECT COUNT(*) FROM "{}" WHERE "ancestor_id" = {} OR "descendant_id" IN ({}, {}))", CLOSURE_TABLE, album, album, song));
+    ASSERT_NE(res, nullptr);
+    auto row = res->nextRow();
+    ASSERT_NE(row, nullptr);
+    EXPECT_EQ(row->col_int(0, -1), 0);
+
+    EXPECT_EQ(getAncestors(other), std::vector<int>({ -1, CDS_ID_ROOT, artist, other }));
+    EXPECT_EQ(searchItems(artist), std::vector<std::string>({ "Other" }));
+}
@@ -22,7 +22,9 @@
 */
 
 /// \file test_sql_generators.cc
+#include "cds/cds_enums.h"
 #include "database/sql_database.h"
+#include "database/sql_table.h"
 
 #include "sqlite_config_fake.h"
 
@@ -146,3 +148,54 @@ TEST_F(DatabaseTest, DeleteTest)
     database->deleteRows("Table", "id", { 1, 2, 3 });
     EXPECT_EQ(database->lastStatement, "DELETE FROM [Table] WHERE [id] IN (1,2,3)");
 }
+
+TEST_F(DatabaseTest, ResourceMultiInsertTest)
+{
+    auto columnMapper = std::make_shared<EnumColumnMapper<ResourceColumn>>('[', ']', "re", "grb_resource",
+        std::vector<std::pair<std::string, ResourceColumn>> {},
+        std::map<ResourceColumn, SearchProperty> {
+            { ResourceColumn::ItemId, { "re", "item_id" } },
+            { ResourceColumn::ResId, { "re", "res_id" } },
+            { ResourceColumn::HandlerType, { "re", "handlerType" } },
+            { ResourceColumn::Purpose, { "re", "purpose" } },
+            { ResourceColumn::Options, { "re", "options" } },
+            { ResourceColumn::Parameters, { "re", "parameters" } },
+        });
+    std::vector<std::map<ResourceColumn, std::string>> rows {
+        { { ResourceColumn::ItemId, "1" }, { ResourceColumn::ResId, "0" }, { ResourceColumn::HandlerType, "0" }, { ResourceColumn::Purpose, "0" } },
+        { { ResourceColumn::ItemId, "2" }, { ResourceColumn::ResId, "0" }, { ResourceColumn::HandlerType, "0" }, { ResourceColumn::Purpose, "0" } },
+    };
+    std::vector<std::map<ResourceAttribute, std::string>> attributes {
+        { { ResourceAttribute::SIZE, "\"100\"" } },
+        { { ResourceAttribute::DURATION, "\"0:01:00\"" } },
+    };
+    Resource2Table table(std::move(rows), std::move(attributes), columnMapper);
+    EXPECT_EQ(table.sqlForMultiInsert(nullptr),
+        "INSERT INTO [grb_resource] ([item_id], [res_id], [handlerType], [purpose], [options], [parameters], [size], [duration]) "
+        "VALUES (1,0,0,0,NULL,NULL,\"100\",NULL), (2,0,0,0,NULL,NULL,NULL,\"0:01:00\")");
+}
+
+TEST_F(DatabaseTest, PreparedFormatTest)
+{
+    EXPECT_EQ(database->formatPrepared("SELECT * FROM [Table] WHERE [a] = ? AND [b] = ?", { 42, std::string("Text") }),
+        "SELECT * FROM [Table] WHERE [a] = 42 AND [b] = \"Text\"");
+    EXPECT_EQ(database->formatPrepared("SELECT * FROM [Table] WHERE [a] = '?' AND [b] IN (?,?)", { 1, 2 }),
+        "SELECT * FROM [Table] WHERE [a] = '?' AND [b] IN (1,2)");
+    EXPECT_THROW(database->formatPrepared("SELECT * FROM [Table] WHERE [a] = ?", {}), DatabaseException);
+
+    database->selectPrepared("SELECT * FROM [Table] WHERE [id] = ?", { 7 });
+    EXPECT_EQ(database->lastStatement, "SELECT * FROM [Table] WHERE [id] = 7");
+}
+
+TEST_F(DatabaseTest, SeekClauseTest)
+{
+    std::vector<SQLParam> params;
+    EXPECT_EQ(database->seekClause({ { "[sort_key]", std::string("b") }, { "[id]", 12 } }, params),
+        "(([sort_key], [id]) > (?, ?))");
+    EXPECT_EQ(params, (std::vector<SQLParam> { std::string("b"), 12 }));
+
+    params.clear();
+    EXPECT_EQ(database->seekClause({ { "[upnp_class]", std::string("c") }, { "[sort_key]", std::nullopt }, { "[id]", 12 } }, params),
+        "(([upnp_class] > ?) OR ([upnp_class] = ? AND [sort_key] IS NOT NULL) OR ([upnp_class] = ? AND [sort_key] IS NULL AND [id] > ?))");
+    EXPECT_EQ(params, (std::vector<SQLParam> { std::string("c"), std::string("c"), std::string("c"), 12 }));
+}
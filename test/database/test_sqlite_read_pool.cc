@@ -0,0 +1,126 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_sqlite_read_pool.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_sqlite_read_pool.cc
+
+#include "cds/cds_objects.h"
+#include "config/config.h"
+#include "config/config_options.h"
+#include "config/config_val.h"
+#include "database/sql_database.h"
+
+#include "sqlite_database_fixture.h"
+
+#include <future>
+
+class SqliteReadPoolTest : public SqliteDatabaseFixture {
+public:
+    std::shared_ptr<Database> createPoolDatabase(const std::string& journalMode, bool transactions)
+    {
+        config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_JOURNALMODE, std::make_shared<Option>(journalMode));
+        config->addOption(ConfigVal::SERVER_STORAGE_SQLITE_READ_POOL_SIZE, std::make_shared<IntOption>(2));
+        config->addOption(ConfigVal::SERVER_STORAGE_USE_TRANSACTIONS, std::make_shared<BoolOption>(transactions));
+        return createDatabase(fmt::format("pool-{}-{}.db", journalMode, transactions));
+    }
+
+    static long long readCount(const std::shared_ptr<Database>& database)
+    {
+        return database->getDriverStats().at("sqliteReadCount");
+    }
+};
+
+TEST_F(SqliteReadPoolTest, SelectsRunOnReadConnections)
+{
+    auto database = createPoolDatabase("WAL", false);
+    EXPECT_EQ(database->getDriverStats().at("sqliteReadConnections"), 2);
+
+    auto before = readCount(database);
+    auto root = database->loadObject(CDS_ID_ROOT);
+    ASSERT_NE(root, nullptr);
+    EXPECT_GT(readCount(database), before);
+}
+
+TEST_F(SqliteReadPoolTest, ReadTransactionsRunOnReadConnections)
+{
+    auto database = createPoolDatabase("WAL", true);
+    EXPECT_EQ(database->getDriverStats().at("sqliteReadConnections"), 2);
+
+    auto before = readCount(database);
+    auto root = database->loadObject(CDS_ID_ROOT);
+    ASSERT_NE(root, nullptr);
+    auto counts = database->getChildCounts({ CDS_ID_ROOT }, true, true, false);
+    EXPECT_EQ(counts[CDS_ID_ROOT], 1); // PC Directory
+    EXPECT_GE(readCount(database), before + 2);
+}
+
+TEST_F(SqliteReadPoolTest, WriteTransactionKeepsSelectsOnWriter)
+{
+    auto database = createPoolDatabase("WAL", true);
+    auto sqlDatabase = std::dynamic_pointer_cast<SQLDatabase>(database);
+    ASSERT_NE(sqlDatabase, nullptr);
+
+    sqlDatabase->beginTransaction("test");
+    auto before = readCount(database);
+    // select of the transaction thread must see its own changes
+    auto res = sqlDatabase->select("SELECT 1");
+    ASSERT_NE(res, nullptr);
+    EXPECT_EQ(readCount(database), before);
+
+    // other threads are not blocked by the open transaction
+    auto other = std::async(std::launch::async, [&database] { return database->loadObject(CDS_ID_ROOT); });
+    EXPECT_NE(other.get(), nullptr);
+    EXPECT_GT(readCount(database), before);
+    sqlDatabase->commit("test");
+}
+
+TEST_F(SqliteReadPoolTest, ReadsKeepOpenWriteTransaction)
+{
+    for (auto&& journalMode : { "WAL", "DELETE" }) {
+        auto database = createPoolDatabase(journalMode, true);
+        auto sqlDatabase = std::dynamic_pointer_cast<SQLDatabase>(database);
+        ASSERT_NE(sqlDatabase, nullptr);
+
+        sqlDatabase->beginTransaction("test");
+        sqlDatabase->execOnly("CREATE TABLE \"read_test\" (\"id\" INTEGER)");
+        // loadObject begins and commits a read transaction of its own
+        EXPECT_NE(database->loadObject(CDS_ID_ROOT), nullptr);
+        sqlDatabase->rollback("test");
+
+        auto res = sqlDatabase->select("SELECT COUNT(*) FROM sqlite_master WHERE name = 'read_test'");
+        ASSERT_NE(res, nullptr);
+        auto row = res->nextRow();
+        ASSERT_NE(row, nullptr);
+        EXPECT_EQ(row->col_int(0, -1), 0) << journalMode;
+    }
+}
+
+TEST_F(SqliteReadPoolTest, NoReadConnectionsWithoutWal)
+{
+    auto database = createPoolDatabase("DELETE", true);
+    EXPECT_EQ(database->getDriverStats().at("sqliteReadConnections"), 0);
+
+    auto root = database->loadObject(CDS_ID_ROOT);
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(database->getChildCounts({ CDS_ID_ROOT }, true, true, false)[CDS_ID_ROOT], 1);
+    EXPECT_EQ(readCount(database), 0);
+}
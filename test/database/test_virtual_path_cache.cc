@@ -0,0 +1,87 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_virtual_path_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_virtual_path_cache.cc
+#include "common.h"
+#include "database/virtual_path_cache.h"
+
+#include <gtest/gtest.h>
+
+TEST(VirtualPathCacheTest, AnswersOnlyWhenLoaded)
+{
+    VirtualPathCache cache(10);
+    EXPECT_FALSE(cache.get("/Audio"));
+    cache.set("/Audio", 5);
+    EXPECT_FALSE(cache.get("/Audio"));
+
+    cache.load({ { "/Audio", 5, false }, { "/Audio/Artists", 6, false } }, cache.getGeneration());
+    EXPECT_EQ(cache.get("/Audio"), 5);
+    EXPECT_EQ(cache.get("/Audio/Artists"), 6);
+    EXPECT_EQ(cache.get("/Video"), INVALID_OBJECT_ID);
+}
+
+TEST(VirtualPathCacheTest, FollowsChanges)
+{
+    VirtualPathCache cache(10);
+    cache.load({ { "/Audio", 5, false } }, cache.getGeneration());
+    cache.set("/Audio/Genres", 7);
+    EXPECT_EQ(cache.get("/Audio/Genres"), 7);
+
+    cache.set("/Audio/Genre", 7);
+    EXPECT_EQ(cache.get("/Audio/Genres"), INVALID_OBJECT_ID);
+    EXPECT_EQ(cache.get("/Audio/Genre"), 7);
+
+    cache.erase(5);
+    EXPECT_EQ(cache.get("/Audio"), INVALID_OBJECT_ID);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(VirtualPathCacheTest, PrefersContainerWithoutReference)
+{
+    VirtualPathCache cache(10);
+    cache.load({ { "/Playlists/All", 8, true }, { "/Playlists/All", 9, false } }, cache.getGeneration());
+    EXPECT_EQ(cache.get("/Playlists/All"), 9);
+
+    // the other container still uses the location
+    cache.erase(9);
+    EXPECT_FALSE(cache.get("/Playlists/All"));
+}
+
+TEST(VirtualPathCacheTest, MissesAreUnknownWhenFull)
+{
+    VirtualPathCache cache(2);
+    cache.load({ { "/Audio", 5, false }, { "/Video", 6, false }, { "/Photos", 7, false } }, cache.getGeneration());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(cache.get("/Photos"));
+    EXPECT_FALSE(cache.get("/Other"));
+}
+
+TEST(VirtualPathCacheTest, DropsLoadAfterChange)
+{
+    VirtualPathCache cache(10);
+    auto generation = cache.getGeneration();
+    cache.erase(5);
+    cache.load({ { "/Audio", 5, false } }, generation);
+    EXPECT_FALSE(cache.isLoaded());
+    EXPECT_FALSE(cache.get("/Audio"));
+}
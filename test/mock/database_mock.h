@@ -38,6 +38,7 @@ public:
     void dropTables() override { }
 
     void addObject(const std::shared_ptr<CdsObject>& object, int* changedContainer) override { }
+    void addObjects(const std::vector<std::shared_ptr<CdsObject>>& objects, int* changedContainer) override { }
     bool addContainer(int parentContainerId, std::string virtualPath, const std::shared_ptr<CdsContainer>& cont, int* containerID) override { return true; }
     fs::path buildContainerPath(int parentID, const std::string& title) override { return {}; }
 
@@ -57,6 +58,7 @@ public:
         const fs::path& path,
         const std::string& group,
         DbFileType fileType = DbFileType::Auto) override { return {}; }
+    std::vector<std::pair<fs::path, DbPathEntry>> getPathEntries(const fs::path& path) override { return {}; }
     std::string incrementUpdateIDs(const std::unordered_set<int>& ids) override { return {}; }
 
     std::shared_ptr<CdsObject> loadObject(int objectID, const std::string& group) override { return nullptr; }
@@ -0,0 +1,150 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_import_items.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_import_items.cc
+#ifdef HAVE_JS
+
+#include "content/scripting/script.h"
+#include "content/scripting/scripting_runtime.h"
+
+#include <duktape.h>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+/// @brief batch indices passed to addCdsObject, -1 if no item was passed
+static std::vector<int> addedIndices;
+
+static duk_ret_t addCdsObject(duk_context* ctx)
+{
+    auto index = Script::getBatchIndex(ctx, 1);
+    addedIndices.push_back(index ? static_cast<int>(index.value()) : -1);
+    return 0;
+}
+
+class ImportItemsTest : public ::testing::Test {
+public:
+    void SetUp() override
+    {
+        addedIndices.clear();
+        runtime = std::make_unique<ScriptingRuntime>();
+        ctx = runtime->createContext("importItems");
+        duk_push_c_function(ctx, addCdsObject, 2);
+        duk_put_global_string(ctx, "addCdsObject");
+    }
+
+    void TearDown() override
+    {
+        runtime->destroyContext("importItems");
+    }
+
+    /// @brief call function with an array of items like Script::callItems
+    duk_int_t callItems(const std::string& functionName, std::size_t count)
+    {
+        duk_get_global_string(ctx, functionName.c_str());
+        duk_push_array(ctx);
+        for (std::size_t index = 0; index < count; index++) {
+            duk_push_object(ctx);
+            duk_push_object(ctx);
+            duk_push_string(ctx, fmt::format("item{}", index).c_str());
+            duk_put_prop_string(ctx, -2, "title");
+            duk_put_prop_string(ctx, -2, "obj");
+            Script::putBatchIndex(ctx, -1, index);
+            duk_put_prop_index(ctx, -2, static_cast<duk_uarridx_t>(index));
+        }
+        auto status = duk_pcall(ctx, 1);
+        duk_pop(ctx);
+        return status;
+    }
+
+    std::unique_ptr<ScriptingRuntime> runtime;
+    duk_context* ctx {};
+};
+
+TEST_F(ImportItemsTest, CreatedObjectsBelongToPassedItem)
+{
+    duk_eval_string_noresult(ctx,
+        "function importItems(items) {"
+        "  items.forEach(function (item) {"
+        "    addCdsObject({ title: item.obj.title + ' copy' }, item);"
+        "    addCdsObject({ title: item.obj.title + ' second copy' }, item);"
+        "  });"
+        "}");
+
+    EXPECT_EQ(callItems("importItems", 3), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(addedIndices, std::vector<int>({ 0, 0, 1, 1, 2, 2 }));
+}
+
+TEST_F(ImportItemsTest, CreatedObjectsBelongToPassedIndex)
+{
+    duk_eval_string_noresult(ctx,
+        "function importItems(items) {"
+        "  for (var i = items.length - 1; i >= 0; i--) {"
+        "    addCdsObject({ title: items[i].obj.title }, i);"
+        "  }"
+        "}");
+
+    EXPECT_EQ(callItems("importItems", 3), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(addedIndices, std::vector<int>({ 2, 1, 0 }));
+}
+
+TEST_F(ImportItemsTest, ObjectPropertyCanBeReplaced)
+{
+    duk_eval_string_noresult(ctx,
+        "function importItems(items) {"
+        "  items[1].obj = { title: 'replaced' };"
+        "  if (items[1].obj.title !== 'replaced') throw new Error('replacing failed');"
+        "  addCdsObject(items[1].obj, items[1]);"
+        "}");
+
+    EXPECT_EQ(callItems("importItems", 2), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(addedIndices, std::vector<int>({ 1 }));
+}
+
+TEST_F(ImportItemsTest, ReadingItemDoesNotSelectIt)
+{
+    duk_eval_string_noresult(ctx,
+        "function importItems(items) {"
+        "  var title = items[0].obj.title;"
+        "  addCdsObject({ title: title });"
+        "}");
+
+    EXPECT_EQ(callItems("importItems", 2), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(addedIndices, std::vector<int>({ -1 }));
+}
+
+TEST_F(ImportItemsTest, OtherObjectsAreNoItems)
+{
+    duk_eval_string_noresult(ctx,
+        "function importItems(items) {"
+        "  addCdsObject({ title: 'copy' }, { obj: items[0].obj });"
+        "  addCdsObject({ title: 'copy' }, items[0].obj);"
+        "  addCdsObject({ title: 'copy' }, -1);"
+        "  addCdsObject({ title: 'copy' }, '0');"
+        "}");
+
+    EXPECT_EQ(callItems("importItems", 2), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(addedIndices, std::vector<int>({ -1, -1, -1, -1 }));
+}
+
+#endif
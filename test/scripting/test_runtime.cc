@@ -25,9 +25,49 @@
 
 #include "test_runtime.h"
 
+#include <future>
+
 TEST_F(RuntimeTest, CheckTestCodeLinksAgainstDependencies)
 {
     auto runtime = std::make_unique<ScriptingRuntime>();
     auto ctx = runtime->createContext("testCtx");
     EXPECT_NE(ctx, nullptr);
 }
+
+TEST_F(RuntimeTest, HeapsAreIndependent)
+{
+    auto runtime = std::make_unique<ScriptingRuntime>(2);
+    EXPECT_EQ(runtime->getHeapCount(), 2);
+
+    std::vector<duk_context*> contexts;
+    for (std::size_t heap = 0; heap < runtime->getHeapCount(); heap++) {
+        ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+        contexts.push_back(runtime->createContext("testCtx", heap));
+        ASSERT_NE(contexts.back(), nullptr);
+    }
+
+    // count in both heaps at the same time
+    auto countProc = [&runtime, &contexts](std::size_t heap) {
+        ScriptingRuntime::AutoLock lock(runtime->getMutex(heap));
+        auto ctx = contexts.at(heap);
+        duk_eval_string(ctx, "var counter = 0; for (var i = 0; i < 10000; i++) { counter++; } counter;");
+        return duk_get_int(ctx, -1);
+    };
+    auto first = std::async(std::launch::async, countProc, 0);
+    auto second = std::async(std::launch::async, countProc, 1);
+    EXPECT_EQ(first.get(), 10000);
+    EXPECT_EQ(second.get(), 10000);
+
+    // globals of one heap are not visible in the other
+    {
+        ScriptingRuntime::AutoLock lock(runtime->getMutex(0));
+        duk_eval_string(contexts.at(0), "var onlyHere = 1;");
+    }
+    ScriptingRuntime::AutoLock lock(runtime->getMutex(1));
+    duk_eval_string(contexts.at(1), "typeof onlyHere;");
+    EXPECT_STREQ(duk_get_string(contexts.at(1), -1), "undefined");
+
+    for (std::size_t heap = 0; heap < runtime->getHeapCount(); heap++) {
+        runtime->destroyContext("testCtx", heap);
+    }
+}
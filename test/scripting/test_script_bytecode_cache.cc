@@ -0,0 +1,135 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_script_bytecode_cache.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+/// \file test_script_bytecode_cache.cc
+#include "content/scripting/script.h"
+#include "content/scripting/script_bytecode_cache.h"
+#include "content/scripting/scripting_runtime.h"
+#include "util/string_converter.h"
+
+#include <duktape.h>
+#include <gtest/gtest.h>
+
+class ScriptBytecodeCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        testDir = fs::temp_directory_path() / "gerbera-bytecode-test";
+        fs::remove_all(testDir);
+        fs::create_directories(testDir);
+        scriptPath = testDir / "script.js";
+        GrbFile(scriptPath).writeTextFile(scriptText);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    fs::path testDir;
+    fs::path scriptPath;
+    std::string scriptText = "function test() { return 1; }";
+    std::vector<std::byte> bytecode { std::byte(1), std::byte(2), std::byte('\n'), std::byte(0) };
+};
+
+TEST_F(ScriptBytecodeCacheTest, StoresBytecodeOnDisk)
+{
+    {
+        ScriptBytecodeCache cache(testDir / "cache", "v1");
+        EXPECT_FALSE(cache.get(scriptPath));
+        cache.set(scriptPath, scriptText, bytecode);
+        EXPECT_EQ(cache.get(scriptPath), bytecode);
+        EXPECT_TRUE(fs::exists(cache.getCacheFile(scriptPath)));
+    }
+
+    ScriptBytecodeCache cache(testDir / "cache", "v1");
+    EXPECT_EQ(cache.get(scriptPath), bytecode);
+
+    ScriptBytecodeCache otherVersion(testDir / "cache", "v2");
+    EXPECT_FALSE(otherVersion.get(scriptPath));
+}
+
+TEST_F(ScriptBytecodeCacheTest, ChecksScriptContent)
+{
+    ScriptBytecodeCache cache(testDir / "cache", "v1");
+    cache.set(scriptPath, scriptText, bytecode);
+
+    // same content with new modification time
+    fs::last_write_time(scriptPath, fs::last_write_time(scriptPath) + std::chrono::seconds(10));
+    EXPECT_EQ(cache.get(scriptPath), bytecode);
+
+    // same size, other content
+    GrbFile(scriptPath).writeTextFile("function test() { return 2; }");
+    fs::last_write_time(scriptPath, fs::last_write_time(scriptPath) + std::chrono::seconds(20));
+    EXPECT_FALSE(cache.get(scriptPath));
+    EXPECT_FALSE(ScriptBytecodeCache(testDir / "cache", "v1").get(scriptPath));
+}
+
+TEST_F(ScriptBytecodeCacheTest, IgnoresDamagedFile)
+{
+    {
+        ScriptBytecodeCache cache(testDir / "cache", "v1");
+        cache.set(scriptPath, scriptText, bytecode);
+    }
+    ScriptBytecodeCache cache(testDir / "cache", "v1");
+    auto cacheFile = cache.getCacheFile(scriptPath);
+    auto data = GrbFile(cacheFile).readBinaryFile();
+    ASSERT_TRUE(data);
+    data->pop_back();
+    GrbFile(cacheFile).writeBinaryFile(data->data(), data->size());
+    EXPECT_FALSE(cache.get(scriptPath));
+}
+
+TEST_F(ScriptBytecodeCacheTest, LoadsScriptFromCache)
+{
+    auto cacheDir = testDir / "cache";
+    auto j2i = std::make_shared<StringConverter>("UTF-8", "UTF-8");
+    {
+        ScriptingRuntime runtime(1, cacheDir, "UTF-8");
+        auto ctx = runtime.createContext("compile");
+        EXPECT_FALSE(Script::loadFunction(ctx, runtime.getBytecodeCache(), scriptPath, j2i));
+        EXPECT_TRUE(Script::loadFunction(ctx, runtime.getBytecodeCache(), scriptPath, j2i));
+        duk_pop_2(ctx);
+        runtime.destroyContext("compile");
+    }
+
+    // new heap with cache read from disk
+    ScriptingRuntime runtime(1, cacheDir, "UTF-8");
+    auto ctx = runtime.createContext("load");
+    ASSERT_TRUE(Script::loadFunction(ctx, runtime.getBytecodeCache(), scriptPath, j2i));
+    ASSERT_EQ(duk_pcall(ctx, 0), DUK_EXEC_SUCCESS);
+    duk_pop(ctx);
+
+    ASSERT_TRUE(duk_get_global_string(ctx, "test"));
+    ASSERT_EQ(duk_pcall(ctx, 0), DUK_EXEC_SUCCESS);
+    EXPECT_EQ(duk_get_int(ctx, -1), 1);
+    duk_pop(ctx);
+    runtime.destroyContext("load");
+
+    // bytecode compiled for another charset is not used
+    ScriptingRuntime otherCharset(1, cacheDir, "ISO-8859-1");
+    ctx = otherCharset.createContext("other");
+    EXPECT_FALSE(Script::loadFunction(ctx, otherCharset.getBytecodeCache(), scriptPath, j2i));
+    duk_pop(ctx);
+    otherCharset.destroyContext("other");
+}
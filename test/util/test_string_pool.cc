@@ -0,0 +1,80 @@
+/*GRB*
+
+    Gerbera - https://gerbera.io/
+
+    test_string_pool.cc - this file is part of Gerbera.
+
+    Copyright (C) 2026 Gerbera Contributors
+
+    Gerbera is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 2
+    as published by the Free Software Foundation.
+
+    Gerbera is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Gerbera.  If not, see <http://www.gnu.org/licenses/>.
+
+    $Id$
+*/
+
+#include "util/string_pool.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+TEST(StringPoolTest, sharesEqualStrings)
+{
+    auto first = InternedString("object.item.audioItem.musicTrack");
+    auto second = InternedString(std::string("object.item.audioItem.") + "musicTrack");
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(&first.str(), &second.str());
+    EXPECT_EQ(first.str(), "object.item.audioItem.musicTrack");
+
+    auto size = InternedString::poolSize();
+    InternedString third = first.str();
+    EXPECT_EQ(InternedString::poolSize(), size);
+    EXPECT_EQ(&third.str(), &first.str());
+}
+
+TEST(StringPoolTest, comparesWithStrings)
+{
+    auto mimeType = InternedString("audio/mpeg");
+
+    EXPECT_TRUE(mimeType == std::string("audio/mpeg"));
+    EXPECT_TRUE(mimeType != std::string("audio/flac"));
+    EXPECT_NE(mimeType, InternedString("audio/flac"));
+}
+
+TEST(StringPoolTest, defaultIsEmpty)
+{
+    InternedString empty;
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty, InternedString(""));
+}
+
+TEST(StringPoolTest, limitsPoolSize)
+{
+    auto pooled = InternedString("audio/ogg");
+    for (std::size_t count = 0; count <= InternedString::MAX_POOL_SIZE; count++)
+        InternedString(fmt::format("pool-limit-{}", count));
+    EXPECT_EQ(InternedString::poolSize(), InternedString::MAX_POOL_SIZE);
+
+    // values beyond the limit are kept by the handle
+    auto first = InternedString("not pooled");
+    auto second = InternedString("not pooled");
+    EXPECT_EQ(InternedString::poolSize(), InternedString::MAX_POOL_SIZE);
+    EXPECT_EQ(first.str(), "not pooled");
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, InternedString("also not pooled"));
+    auto copy = first;
+    EXPECT_EQ(&copy.str(), &first.str());
+
+    // strings already in the pool are still shared
+    EXPECT_EQ(&InternedString("audio/ogg").str(), &pooled.str());
+}